@@ -0,0 +1,212 @@
+/**
+ * @file Benchmark.h
+ * @brief Timing and statistics shared by the Face Engine benchmarks.
+ */
+
+#ifndef FACEENGINE_BENCHMARKS_BENCHMARK_H_
+#define FACEENGINE_BENCHMARKS_BENCHMARK_H_
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "FaceEngine/JSON.h"
+
+namespace Benchmark
+{
+    /**
+     * @brief Stops the compiler from optimising away the computation of a value that is never used.
+     */
+    template <class T>
+    inline void DoNotOptimise(const T& value) noexcept
+    {
+    #if defined(__GNUC__) || defined(__clang__)
+        asm volatile("" : : "r"(&value) : "memory");
+    #else
+        const volatile char* sink = reinterpret_cast<const volatile char*>(&value);
+        (void)*sink;
+    #endif
+    }
+
+    /**
+     * @brief Returns the value of a sorted sample at a percentile from 0 to 100, interpolating between the closest ranks.
+     */
+    inline double Percentile(const std::vector<double>& sorted, double p) noexcept
+    {
+        if (sorted.empty())
+        {
+            return 0.0;
+        }
+
+        double rank = p / 100.0 * (sorted.size() - 1);
+        std::size_t lower = (std::size_t)rank;
+        std::size_t upper = std::min(lower + 1, sorted.size() - 1);
+        return sorted[lower] + (rank - lower) * (sorted[upper] - sorted[lower]);
+    }
+
+    inline double Median(std::vector<double> samples) noexcept
+    {
+        std::sort(samples.begin(), samples.end());
+        return Percentile(samples, 50.0);
+    }
+
+    /**
+     * @brief Returns the median absolute deviation of a sample, a measure of spread that a few outliers, such as preempted repetitions, can't skew.
+     */
+    inline double MedianAbsoluteDeviation(const std::vector<double>& samples) noexcept
+    {
+        double median = Median(samples);
+        std::vector<double> deviations;
+        deviations.reserve(samples.size());
+
+        for (double sample : samples)
+        {
+            deviations.push_back(std::abs(sample - median));
+        }
+
+        return Median(std::move(deviations));
+    }
+
+    /**
+     * @brief Parses a positive count from the command line, throwing an exception naming the option if it isn't one.
+     */
+    inline std::size_t ParseCount(const std::string& option, const char* value, bool allowZero = false)
+    {
+        char* end;
+        unsigned long long count = std::strtoull(value, &end, 10);
+
+        if (*value < '0' || *value > '9' || *end != '\0' || (count == 0 && !allowZero))
+        {
+            throw std::runtime_error("Invalid value for " + option + ": " + value);
+        }
+
+        return (std::size_t)count;
+    }
+
+    struct MicrobenchmarkResult
+    {
+        std::string Name;
+        std::string Variant;
+        std::size_t Iterations;
+
+        // nanoseconds per iteration of each measured repetition
+        std::vector<double> Samples;
+        double Median;
+        double MAD;
+    };
+
+    /**
+     * @brief Times small operations by running them in a calibrated loop and reporting the median and MAD of several repetitions.
+     *
+     * The iteration count is doubled until one repetition takes at least the minimum time, which also warms up caches and branch predictors.
+     * A few more repetitions are then discarded before the measured ones. Variants of the same benchmark, such as scalar and SIMD implementations,
+     * share a name and are compared against the "scalar" variant.
+     */
+    class MicrobenchmarkRunner
+    {
+    private:
+        std::vector<MicrobenchmarkResult> results;
+    public:
+        std::string Filter;
+        std::size_t Repetitions = 15;
+        std::size_t WarmupRepetitions = 3;
+        double MinimumSeconds = 0.01;
+
+        template <class F>
+        void Run(const std::string& name, const std::string& variant, F function)
+        {
+            if (!Filter.empty() && name.find(Filter) == std::string::npos)
+            {
+                return;
+            }
+
+            auto repeat = [&function](std::size_t iterations)
+            {
+                std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+
+                for (std::size_t i = 0; i < iterations; ++i)
+                {
+                    function(i);
+                }
+
+                return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+            };
+
+            std::size_t iterations = 1;
+
+            while (repeat(iterations) < MinimumSeconds && iterations < ((std::size_t)1 << 40))
+            {
+                iterations *= 2;
+            }
+
+            for (std::size_t i = 0; i < WarmupRepetitions; ++i)
+            {
+                repeat(iterations);
+            }
+
+            MicrobenchmarkResult result;
+            result.Name = name;
+            result.Variant = variant;
+            result.Iterations = iterations;
+
+            for (std::size_t i = 0; i < Repetitions; ++i)
+            {
+                result.Samples.push_back(repeat(iterations) * 1e9 / iterations);
+            }
+
+            result.Median = Median(result.Samples);
+            result.MAD = MedianAbsoluteDeviation(result.Samples);
+            std::fprintf(stderr, "%-40s %-8s %12.3f ns  +- %.3f\n", name.c_str(), variant.c_str(), result.Median, result.MAD);
+            results.push_back(std::move(result));
+        }
+
+        inline const std::vector<MicrobenchmarkResult>& GetResults() const noexcept { return results; }
+
+        /**
+         * @brief Returns how many times faster a variant is than the scalar variant of the same benchmark, or zero if there is no scalar variant.
+         */
+        double GetSpeedup(const MicrobenchmarkResult& result) const noexcept
+        {
+            for (const MicrobenchmarkResult& scalar : results)
+            {
+                if (scalar.Name == result.Name && scalar.Variant == "scalar" && result.Median > 0.0)
+                {
+                    return scalar.Median / result.Median;
+                }
+            }
+
+            return 0.0;
+        }
+
+        std::string ToJSON(const std::string& benchmark) const
+        {
+            std::string json = "{\n  \"benchmark\": \"" + FaceEngine::EscapeJSON(benchmark) + "\",\n  \"unit\": \"ns\",\n  \"results\": [";
+            char buffer[256];
+
+            for (std::size_t i = 0; i < results.size(); ++i)
+            {
+                const MicrobenchmarkResult& result = results[i];
+                std::vector<double> sorted = result.Samples;
+                std::sort(sorted.begin(), sorted.end());
+
+                json += i > 0 ? ",\n    { \"name\": \"" : "\n    { \"name\": \"";
+                json += FaceEngine::EscapeJSON(result.Name);
+                json += "\", \"variant\": \"";
+                json += FaceEngine::EscapeJSON(result.Variant);
+                std::snprintf(buffer, sizeof(buffer), "\", \"iterations\": %zu, \"repetitions\": %zu, \"median\": %.4f, \"mad\": %.4f, \"min\": %.4f, \"max\": %.4f, \"speedup\": %.3f }",
+                    result.Iterations, sorted.size(), result.Median, result.MAD, sorted.front(), sorted.back(), GetSpeedup(result));
+                json += buffer;
+            }
+
+            json += "\n  ]\n}\n";
+            return json;
+        }
+    };
+}
+
+#endif
\ No newline at end of file
@@ -0,0 +1,549 @@
+/**
+ * @file ContentBenchmarks.cpp
+ * @brief FaceEngineContentBenchmarks, measures how long ContentLoader takes to load textures and fonts, phase by phase, and writes the results as JSON.
+ *
+ * Usage: FaceEngineContentBenchmarks [-o <output.json>] [--dir <directory>] [--repetitions <count>] [--filter <substring>] [--cache <warm|cold>]
+ *
+ * Synthetic content files are written with the content builder's ContentWriter at several sizes and compression levels, then each is
+ * loaded repeatedly in an offscreen game with a load tracer set, which splits every load into reading, inflating, RGBA expansion and upload.
+ * The time glFinish then takes is reported separately, as the driver may finish uploads after the load returns.
+ *
+ * Warm loads read files already in the page cache. Before each cold load the file is dropped from the page cache, which is only supported on
+ * Linux and has no effect on filesystems kept in memory such as tmpfs; each cold result reports how much of the file was still resident.
+ * The generated files are deleted afterwards. Results go to standard output without -o.
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#ifdef __linux__
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+#include "Benchmark.h"
+#include "ContentWriter.h"
+#include "FaceEngine/Game.h"
+
+using namespace FaceEngine;
+
+namespace
+{
+    const std::uint32_t TextureSizes[] = { 64, 256, 1024, 2048 };
+    const std::uint8_t TextureCompressLevels[] = { 0, 1, 6, 9 };
+    const std::uint32_t FontSizes[] = { 12, 24, 48 };
+    const std::uint8_t FontCompressLevels[] = { 0, 6, 9 };
+
+    enum CacheState
+    {
+        CacheWarm,
+        CacheCold,
+        CacheStateCount
+    };
+
+    const char* CacheStateNames[CacheStateCount] = { "warm", "cold" };
+
+    struct BenchmarkOptions
+    {
+        std::string Output;
+        std::string Directory = (std::filesystem::temp_directory_path() / "FaceEngineContentBenchmarks").string();
+        std::size_t Repetitions = 10;
+        std::string Filter;
+        std::string Cache;
+    };
+
+    struct ContentCase
+    {
+        std::string Name;
+        ContentFileType Type;
+        std::uint32_t Size;
+        std::uint8_t CompressLevel;
+        std::string Path;
+    };
+
+    struct CaseResult
+    {
+        const ContentCase* Case;
+        CacheState Cache;
+        std::uint64_t FileBytes = 0;
+        std::uint64_t TextureBytes = 0;
+
+        // milliseconds per load
+        std::vector<double> Total;
+        std::vector<double> Read;
+        std::vector<double> Inflate;
+        std::vector<double> Expand;
+        std::vector<double> Upload;
+        std::vector<double> Finish;
+
+        // fraction of the file still in the page cache after dropping it, or negative if it couldn't be dropped
+        double MaxResident = 0.0;
+    };
+
+    class ContentGenerator
+    {
+    private:
+        std::uint32_t state = 12345;
+    public:
+        inline std::uint8_t Next() noexcept
+        {
+            state = state * 1664525 + 1013904223;
+            return (std::uint8_t)(state >> 24);
+        }
+
+        // gradients with a little noise, which compress about as well as typical sprite art
+        TextureContent CreateTexture(std::uint32_t size, std::uint8_t level)
+        {
+            TextureContent texture;
+            texture.Width = size;
+            texture.Height = size;
+            texture.CompressLevel = level;
+            texture.Pixels.resize((std::size_t)size * size * 4);
+
+            for (std::uint32_t y = 0; y < size; ++y)
+            {
+                for (std::uint32_t x = 0; x < size; ++x)
+                {
+                    std::uint8_t* pixel = &texture.Pixels[((std::size_t)y * size + x) * 4];
+                    pixel[0] = (std::uint8_t)(x * 255 / size);
+                    pixel[1] = (std::uint8_t)(y * 255 / size);
+                    pixel[2] = (std::uint8_t)(128 + (Next() & 0x1F));
+                    pixel[3] = ((x / 16 + y / 16) % 4) == 0 ? 0 : 0xFF;
+                }
+            }
+
+            return texture;
+        }
+
+        // printable ASCII, with glyphs shaped as rings so coverage has soft edges and empty space like real glyphs
+        FontContent CreateFont(std::uint32_t size, std::uint8_t level)
+        {
+            FontContent font;
+            font.Size = size;
+            font.Ascender = (std::int32_t)size * 64;
+            font.Descender = -(std::int32_t)size * 16;
+            font.LineSpacing = (std::int32_t)size * 80;
+            font.CompressLevel = level;
+
+            for (std::uint32_t c = 32; c < 127; ++c)
+            {
+                GlyphContent glyph;
+                glyph.CharCode = c;
+                glyph.Width = c == ' ' ? 0 : size * 3 / 5;
+                glyph.Height = c == ' ' ? 0 : size;
+                glyph.BearingX = 1;
+                glyph.BearingY = (std::int32_t)glyph.Height;
+                glyph.Advance = (std::int32_t)(size * 3 / 5 + 2) * 64;
+                glyph.Coverage.resize((std::size_t)glyph.Width * glyph.Height);
+
+                for (std::uint32_t y = 0; y < glyph.Height; ++y)
+                {
+                    for (std::uint32_t x = 0; x < glyph.Width; ++x)
+                    {
+                        float dx = (x + 0.5f) / glyph.Width - 0.5f;
+                        float dy = (y + 0.5f) / glyph.Height - 0.5f;
+                        float edge = std::abs(dx * dx + dy * dy - 0.12f) * 40.0f;
+                        glyph.Coverage[(std::size_t)y * glyph.Width + x] = (std::uint8_t)(255.0f * std::max(0.0f, 1.0f - edge));
+                    }
+                }
+
+                font.Glyphs.push_back(std::move(glyph));
+            }
+
+            return font;
+        }
+    };
+
+    void WriteContentFile(const std::string& path, const std::vector<std::uint8_t>& data)
+    {
+        std::FILE* fp = std::fopen(path.c_str(), "wb");
+
+        if (!fp)
+        {
+            throw std::runtime_error("Couldn't open " + path + " for writing");
+        }
+
+        bool written = std::fwrite(data.data(), 1, data.size(), fp) == data.size() && std::fflush(fp) == 0;
+
+    #ifdef __linux__
+        // dirty pages can't be dropped from the page cache, so cold loads need the file on disk first
+        written = written && fsync(fileno(fp)) == 0;
+    #endif
+
+        if (std::fclose(fp) != 0 || !written)
+        {
+            throw std::runtime_error("Couldn't write " + path);
+        }
+    }
+
+    // drops a file from the page cache, returning the fraction of it still resident afterwards, or a negative value if that isn't supported
+    double DropFromPageCache(const std::string& path)
+    {
+    #ifdef __linux__
+        int fd = open(path.c_str(), O_RDONLY);
+
+        if (fd < 0)
+        {
+            return -1.0;
+        }
+
+        double resident = -1.0;
+        off_t size = lseek(fd, 0, SEEK_END);
+
+        if (size > 0 && posix_fadvise(fd, 0, 0, POSIX_FADV_DONTNEED) == 0)
+        {
+            void* mapping = mmap(nullptr, size, PROT_READ, MAP_SHARED, fd, 0);
+
+            if (mapping != MAP_FAILED)
+            {
+                long pageSize = sysconf(_SC_PAGESIZE);
+                std::vector<unsigned char> pages((size + pageSize - 1) / pageSize);
+
+                if (mincore(mapping, size, pages.data()) == 0)
+                {
+                    std::size_t count = std::count_if(pages.begin(), pages.end(), [](unsigned char page) { return (page & 1) != 0; });
+                    resident = (double)count / pages.size();
+                }
+
+                munmap(mapping, size);
+            }
+        }
+
+        close(fd);
+        return resident;
+    #else
+        (void)path;
+        return -1.0;
+    #endif
+    }
+
+    // reads a whole file so the load after it finds every page cached
+    void ReadIntoPageCache(const std::string& path)
+    {
+        std::ifstream file(path, std::ios::binary);
+        char buffer[65536];
+
+        while (file.read(buffer, sizeof(buffer)) || file.gcount() > 0) { }
+    }
+
+    class ContentBenchmark : public Game
+    {
+    private:
+        BenchmarkOptions options;
+        std::vector<ContentCase> cases;
+        std::vector<CacheState> cacheStates;
+        std::vector<CaseResult> results;
+        std::string renderer;
+        ContentLoadTrace lastTrace;
+
+        void GenerateContent()
+        {
+            std::filesystem::create_directories(options.Directory);
+            ContentGenerator generator;
+
+            for (const ContentCase& c : cases)
+            {
+                if (c.Type == TypeTexture2D)
+                {
+                    TextureContent texture = generator.CreateTexture(c.Size, c.CompressLevel);
+                    ContentWriter::PrepareChunks(texture);
+
+                    for (ContentChunk& band : texture.Bands)
+                    {
+                        ContentWriter::CompressChunk(band, c.CompressLevel);
+                    }
+
+                    WriteContentFile(c.Path, ContentWriter::WriteTexture2D(texture));
+                }
+                else
+                {
+                    FontContent font = generator.CreateFont(c.Size, c.CompressLevel);
+                    ContentWriter::PrepareChunks(font);
+
+                    for (ContentChunk& chunk : font.GlyphChunks)
+                    {
+                        ContentWriter::CompressChunk(chunk, c.CompressLevel);
+                    }
+
+                    WriteContentFile(c.Path, ContentWriter::WriteTextureFont(font));
+                }
+            }
+        }
+
+        void RemoveContent()
+        {
+            std::error_code error;
+
+            for (const ContentCase& c : cases)
+            {
+                std::filesystem::remove(c.Path, error);
+            }
+
+            std::filesystem::remove(options.Directory, error);
+        }
+
+        void Load(const ContentCase& c)
+        {
+            Resource* resource;
+
+            if (c.Type == TypeTexture2D)
+            {
+                resource = ContentLoaderPtr->LoadTexture2D(c.Path);
+            }
+            else
+            {
+                resource = ContentLoaderPtr->LoadTextureFont(c.Path);
+            }
+
+            ResourceManagerPtr->DisposeResource(resource);
+        }
+
+        CaseResult Measure(const ContentCase& c, CacheState cache)
+        {
+            CaseResult result;
+            result.Case = &c;
+            result.Cache = cache;
+
+            // the first load isn't measured, so one-off costs such as growing the heap aren't counted
+            Load(c);
+            glFinish();
+
+            for (std::size_t i = 0; i < options.Repetitions; ++i)
+            {
+                if (cache == CacheCold)
+                {
+                    double resident = DropFromPageCache(c.Path);
+                    result.MaxResident = resident < 0.0 || result.MaxResident < 0.0 ? -1.0 : std::max(result.MaxResident, resident);
+                }
+                else
+                {
+                    ReadIntoPageCache(c.Path);
+                }
+
+                // the trace covers the load itself, not disposing the resource afterwards
+                Load(c);
+                std::chrono::steady_clock::time_point loaded = std::chrono::steady_clock::now();
+                glFinish();
+                std::chrono::steady_clock::time_point finished = std::chrono::steady_clock::now();
+
+                result.FileBytes = lastTrace.FileBytes;
+                result.TextureBytes = lastTrace.TextureBytes;
+                result.Total.push_back(lastTrace.TotalSeconds * 1000.0);
+                result.Read.push_back(lastTrace.ReadSeconds * 1000.0);
+                result.Inflate.push_back(lastTrace.InflateSeconds * 1000.0);
+                result.Expand.push_back(lastTrace.ExpandSeconds * 1000.0);
+                result.Upload.push_back(lastTrace.UploadSeconds * 1000.0);
+                result.Finish.push_back(std::chrono::duration<double, std::milli>(finished - loaded).count());
+            }
+
+            std::fprintf(stderr, "%-24s %-5s %10.3f ms  (read %.3f, inflate %.3f, expand %.3f, upload %.3f, finish %.3f)\n",
+                c.Name.c_str(), CacheStateNames[cache], Benchmark::Median(result.Total), Benchmark::Median(result.Read), Benchmark::Median(result.Inflate),
+                Benchmark::Median(result.Expand), Benchmark::Median(result.Upload), Benchmark::Median(result.Finish));
+            return result;
+        }
+    public:
+        ContentBenchmark(const BenchmarkOptions& o)
+        {
+            options = o;
+            Offscreen = true;
+            OffscreenResolution = Resolution(64, 64);
+
+            for (std::uint32_t size : TextureSizes)
+            {
+                for (std::uint8_t level : TextureCompressLevels)
+                {
+                    cases.push_back({ "texture_" + std::to_string(size) + "_level" + std::to_string(level), TypeTexture2D, size, level, std::string() });
+                }
+            }
+
+            for (std::uint32_t size : FontSizes)
+            {
+                for (std::uint8_t level : FontCompressLevels)
+                {
+                    cases.push_back({ "font_" + std::to_string(size) + "_level" + std::to_string(level), TypeTextureFont, size, level, std::string() });
+                }
+            }
+
+            cases.erase(std::remove_if(cases.begin(), cases.end(), [this](const ContentCase& c)
+            {
+                return !options.Filter.empty() && c.Name.find(options.Filter) == std::string::npos;
+            }), cases.end());
+
+            for (ContentCase& c : cases)
+            {
+                c.Path = (std::filesystem::path(options.Directory) / (c.Name + ".fecf")).string();
+            }
+
+            for (int i = 0; i < CacheStateCount; ++i)
+            {
+                if (options.Cache.empty() || options.Cache == CacheStateNames[i])
+                {
+                    cacheStates.push_back((CacheState)i);
+                }
+            }
+        }
+
+        inline bool HasCases() const noexcept { return !cases.empty() && !cacheStates.empty(); }
+
+        void Initialise() override
+        {
+            renderer = (const char*)glGetString(GL_RENDERER);
+            ContentLoaderPtr->SetLoadTracer([this](const ContentLoadTrace& trace) { lastTrace = trace; });
+
+            try
+            {
+                GenerateContent();
+
+                for (const ContentCase& c : cases)
+                {
+                    for (CacheState cache : cacheStates)
+                    {
+                        results.push_back(Measure(c, cache));
+                    }
+                }
+            }
+            catch (...)
+            {
+                RemoveContent();
+                throw;
+            }
+
+            RemoveContent();
+
+            for (const CaseResult& result : results)
+            {
+                if (result.Cache == CacheCold && (result.MaxResident < 0.0 || result.MaxResident > 0.0))
+                {
+                    std::fprintf(stderr, "Files couldn't be dropped from the page cache, so cold results are warm. Use --dir on a disk-backed filesystem.\n");
+                    break;
+                }
+            }
+
+            ContentLoaderPtr->SetLoadTracer(nullptr);
+            Exit();
+        }
+
+        std::string ToJSON() const
+        {
+            std::string json = "{\n  \"benchmark\": \"content\",\n  \"renderer\": \"" + EscapeJSON(renderer) + "\",\n  \"directory\": \"" +
+                EscapeJSON(options.Directory) + "\",\n  \"unit\": \"ms\",\n  \"results\": [";
+            char buffer[512];
+
+            for (std::size_t i = 0; i < results.size(); ++i)
+            {
+                const CaseResult& result = results[i];
+                double total = Benchmark::Median(result.Total);
+                char resident[16] = "null";
+
+                if (result.Cache == CacheCold)
+                {
+                    std::snprintf(resident, sizeof(resident), "%.3f", result.MaxResident);
+                }
+
+                std::snprintf(buffer, sizeof(buffer),
+                    "%s\n    {\n      \"name\": \"%s\",\n      \"type\": \"%s\",\n      \"size\": %u,\n      \"compressLevel\": %u,\n      \"cache\": \"%s\",\n"
+                    "      \"residentAfterDrop\": %s,\n      \"loads\": %zu,\n      \"fileBytes\": %llu,\n      \"textureBytes\": %llu,\n      \"fileMBPerSecond\": %.1f,\n",
+                    i > 0 ? "," : "", result.Case->Name.c_str(), result.Case->Type == TypeTexture2D ? "texture2D" : "textureFont", result.Case->Size,
+                    result.Case->CompressLevel, CacheStateNames[result.Cache], resident, result.Total.size(),
+                    (unsigned long long)result.FileBytes, (unsigned long long)result.TextureBytes, total > 0.0 ? result.FileBytes / (total * 1000.0) : 0.0);
+                json += buffer;
+
+                std::snprintf(buffer, sizeof(buffer),
+                    "      \"total\": { \"median\": %.4f, \"mad\": %.4f },\n      \"phases\": { \"read\": %.4f, \"inflate\": %.4f, \"expand\": %.4f, \"upload\": %.4f, \"finish\": %.4f }\n    }",
+                    total, Benchmark::MedianAbsoluteDeviation(result.Total), Benchmark::Median(result.Read), Benchmark::Median(result.Inflate),
+                    Benchmark::Median(result.Expand), Benchmark::Median(result.Upload), Benchmark::Median(result.Finish));
+                json += buffer;
+            }
+
+            json += "\n  ]\n}\n";
+            return json;
+        }
+    };
+}
+
+int main(int argc, char** argv)
+{
+    BenchmarkOptions options;
+
+    try
+    {
+        for (int i = 1; i < argc; ++i)
+        {
+            std::string arg = argv[i];
+
+            if (i + 1 >= argc)
+            {
+                throw std::runtime_error("Missing value for " + arg);
+            }
+            else if (arg == "-o")
+            {
+                options.Output = argv[++i];
+            }
+            else if (arg == "--dir")
+            {
+                options.Directory = argv[++i];
+            }
+            else if (arg == "--repetitions")
+            {
+                options.Repetitions = Benchmark::ParseCount(arg, argv[++i]);
+            }
+            else if (arg == "--filter")
+            {
+                options.Filter = argv[++i];
+            }
+            else if (arg == "--cache")
+            {
+                options.Cache = argv[++i];
+            }
+            else
+            {
+                throw std::runtime_error("Unknown option " + arg);
+            }
+        }
+
+        ContentBenchmark benchmark(options);
+
+        if (!benchmark.HasCases())
+        {
+            throw std::runtime_error("No content matches the filter and cache options");
+        }
+
+        benchmark.Run();
+        std::string json = benchmark.ToJSON();
+
+        if (options.Output.empty())
+        {
+            std::cout << json;
+        }
+        else
+        {
+            std::ofstream file(options.Output);
+
+            if (!(file << json))
+            {
+                throw std::runtime_error("Couldn't write " + options.Output);
+            }
+        }
+    }
+    catch (const Exception& e)
+    {
+        std::cerr << e.GetMessage() << "\n";
+        return 1;
+    }
+    catch (const std::exception& e)
+    {
+        std::cerr << e.what() << "\n";
+        return 1;
+    }
+
+    return 0;
+}
\ No newline at end of file
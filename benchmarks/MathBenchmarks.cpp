@@ -0,0 +1,496 @@
+/**
+ * @file MathBenchmarks.cpp
+ * @brief FaceEngineMathBenchmarks, times the math types on the engine's hot paths and writes the results as JSON.
+ *
+ * Usage: FaceEngineMathBenchmarks [-o <output.json>] [--repetitions <count>] [--min-time-ms <milliseconds>] [--filter <substring>]
+ *
+ * Each benchmark cycles through a small table of pseudo-random inputs so the compiler can't fold the work away.
+ * Matrix4f operations, single and batched, are timed both with the engine's implementation, named after the SIMD instruction set it was
+ * compiled for, and with a plain scalar implementation in this file, so the speedup of the SIMD kernels is reported for the same build.
+ * Per-benchmark progress goes to standard error and the JSON results go to standard output without -o.
+ */
+
+#include <algorithm>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "Benchmark.h"
+#include "FaceEngine/Graphics/Colour.h"
+#include "FaceEngine/Math/Matrix4f.h"
+#include "FaceEngine/Math/Rectangle.h"
+#include "FaceEngine/Math/SIMD.h"
+#include "FaceEngine/Math/Vector2.h"
+#include "FaceEngine/Math/Vector3.h"
+#include "FaceEngine/Math/Vector4.h"
+
+using namespace FaceEngine;
+using Benchmark::DoNotOptimise;
+
+namespace
+{
+    // a power of two, so cycling through the inputs is a mask
+    constexpr std::size_t InputCount = 256;
+    constexpr std::size_t InputMask = InputCount - 1;
+
+    class InputGenerator
+    {
+    private:
+        std::uint32_t state = 12345;
+    public:
+        // uniform in [min, max)
+        inline float Next(float min, float max) noexcept
+        {
+            state = state * 1664525 + 1013904223;
+            return min + (max - min) * ((state >> 8) / 16777216.0f);
+        }
+    };
+
+    struct MathInputs
+    {
+        std::vector<Matrix4f> Matrices;
+        std::vector<Vector2f> Vector2s;
+        std::vector<Vector3f> Vector3s;
+        std::vector<Vector4f> Vector4s;
+        std::vector<Rectanglef> Rectangles;
+        std::vector<Colour> Colours;
+        std::vector<int> Hues;
+        std::vector<float> Fractions;
+
+        MathInputs()
+        {
+            InputGenerator random;
+
+            for (std::size_t i = 0; i < InputCount; ++i)
+            {
+                // diagonally dominant, so every matrix is invertible
+                Matrix4f matrix;
+
+                for (int j = 0; j < 16; ++j)
+                {
+                    matrix[j] = j % 5 == 0 ? random.Next(8.0f, 16.0f) : random.Next(-1.0f, 1.0f);
+                }
+
+                Matrices.push_back(matrix);
+                Vector2s.emplace_back(random.Next(-100.0f, 100.0f), random.Next(-100.0f, 100.0f));
+                Vector3s.emplace_back(random.Next(-100.0f, 100.0f), random.Next(-100.0f, 100.0f), random.Next(-100.0f, 100.0f));
+                Vector4s.emplace_back(random.Next(-100.0f, 100.0f), random.Next(-100.0f, 100.0f), random.Next(-100.0f, 100.0f), 1.0f);
+                Rectangles.emplace_back(random.Next(0.0f, 1000.0f), random.Next(0.0f, 1000.0f), random.Next(1.0f, 200.0f), random.Next(1.0f, 200.0f));
+                Colours.emplace_back(random.Next(0.0f, 1.0f), random.Next(0.0f, 1.0f), random.Next(0.0f, 1.0f), 1.0f);
+                Hues.push_back((int)random.Next(0.0f, 360.0f));
+                Fractions.push_back(random.Next(0.0f, 1.0f));
+            }
+        }
+    };
+
+    // plain scalar versions of the Matrix4f operations, the baseline for the engine's SIMD kernels
+    namespace Scalar
+    {
+        Matrix4f Multiply(const Matrix4f& a, const Matrix4f& b) noexcept
+        {
+            Matrix4f product;
+
+            for (int row = 0; row < 4; ++row)
+            {
+                for (int column = 0; column < 4; ++column)
+                {
+                    product.Elements[row * 4 + column] = a.Elements[row * 4] * b.Elements[column] + a.Elements[row * 4 + 1] * b.Elements[4 + column]
+                                                       + a.Elements[row * 4 + 2] * b.Elements[8 + column] + a.Elements[row * 4 + 3] * b.Elements[12 + column];
+                }
+            }
+
+            return product;
+        }
+
+        Vector4f Transform(const Matrix4f& m, const Vector4f& v) noexcept
+        {
+            return Vector4f(m.M11 * v.X + m.M12 * v.Y + m.M13 * v.Z + m.M14 * v.W, m.M21 * v.X + m.M22 * v.Y + m.M23 * v.Z + m.M24 * v.W,
+                            m.M31 * v.X + m.M32 * v.Y + m.M33 * v.Z + m.M34 * v.W, m.M41 * v.X + m.M42 * v.Y + m.M43 * v.Z + m.M44 * v.W);
+        }
+
+        Vector3f Transform(const Matrix4f& m, const Vector3f& v) noexcept
+        {
+            return Vector3f(m.M11 * v.X + m.M12 * v.Y + m.M13 * v.Z + m.M14, m.M21 * v.X + m.M22 * v.Y + m.M23 * v.Z + m.M24,
+                            m.M31 * v.X + m.M32 * v.Y + m.M33 * v.Z + m.M34);
+        }
+
+        Vector2f Transform(const Matrix4f& m, const Vector2f& v) noexcept
+        {
+            return Vector2f(m.M11 * v.X + m.M12 * v.Y + m.M14, m.M21 * v.X + m.M22 * v.Y + m.M24);
+        }
+
+        // the bounding box of the four transformed corners, as callers wrote it before TransformBounds
+        Rectanglef TransformBounds(const Matrix4f& m, const Rectanglef& rect) noexcept
+        {
+            Vector2f corners[4] = { Transform(m, Vector2f(rect.X, rect.Y)), Transform(m, Vector2f(rect.GetRight(), rect.Y)),
+                                    Transform(m, Vector2f(rect.X, rect.GetBottom())), Transform(m, Vector2f(rect.GetRight(), rect.GetBottom())) };
+            Vector2f min = corners[0];
+            Vector2f max = corners[0];
+
+            for (int j = 1; j < 4; ++j)
+            {
+                min = Vector2f(std::min(min.X, corners[j].X), std::min(min.Y, corners[j].Y));
+                max = Vector2f(std::max(max.X, corners[j].X), std::max(max.Y, corners[j].Y));
+            }
+
+            return Rectanglef(min.X, min.Y, max.X - min.X, max.Y - min.Y);
+        }
+
+        float GetDeterminant(const Matrix4f& m) noexcept
+        {
+            return m.M11 * (m.M22 * (m.M33 * m.M44 - m.M34 * m.M43) - m.M23 * (m.M32 * m.M44 - m.M34 * m.M42) + m.M24 * (m.M32 * m.M43 - m.M33 * m.M42))
+                 - m.M12 * (m.M21 * (m.M33 * m.M44 - m.M34 * m.M43) - m.M23 * (m.M31 * m.M44 - m.M34 * m.M41) + m.M24 * (m.M31 * m.M43 - m.M33 * m.M41))
+                 + m.M13 * (m.M21 * (m.M32 * m.M44 - m.M34 * m.M42) - m.M22 * (m.M31 * m.M44 - m.M34 * m.M41) + m.M24 * (m.M31 * m.M42 - m.M32 * m.M41))
+                 - m.M14 * (m.M21 * (m.M32 * m.M43 - m.M33 * m.M42) - m.M22 * (m.M31 * m.M43 - m.M33 * m.M41) + m.M23 * (m.M31 * m.M42 - m.M32 * m.M41));
+        }
+
+        Matrix4f Transpose(const Matrix4f& m) noexcept
+        {
+            Matrix4f transpose;
+
+            for (int j = 0; j < 16; ++j)
+            {
+                transpose.Elements[j] = m.Elements[(j % 4) * 4 + j / 4];
+            }
+
+            return transpose;
+        }
+    }
+
+    void RunMatrixBenchmarks(Benchmark::MicrobenchmarkRunner& runner, const MathInputs& in)
+    {
+        runner.Run("Matrix4f::operator*(Matrix4f)", "scalar", [&in](std::size_t i)
+        {
+            DoNotOptimise(Scalar::Multiply(in.Matrices[i & InputMask], in.Matrices[(i + 1) & InputMask]));
+        });
+
+        runner.Run("Matrix4f::operator*(Matrix4f)", SIMDInstructionSet, [&in](std::size_t i)
+        {
+            DoNotOptimise(in.Matrices[i & InputMask] * in.Matrices[(i + 1) & InputMask]);
+        });
+
+        runner.Run("Matrix4f::Multiply(Matrix4f)", SIMDInstructionSet, [&in](std::size_t i)
+        {
+            Matrix4f matrix = in.Matrices[i & InputMask];
+            matrix.Multiply(in.Matrices[(i + 1) & InputMask]);
+            DoNotOptimise(matrix);
+        });
+
+        runner.Run("Matrix4f::operator*(Vector4f)", "scalar", [&in](std::size_t i)
+        {
+            DoNotOptimise(Scalar::Transform(in.Matrices[i & InputMask], in.Vector4s[i & InputMask]));
+        });
+
+        runner.Run("Matrix4f::operator*(Vector4f)", SIMDInstructionSet, [&in](std::size_t i)
+        {
+            DoNotOptimise(in.Matrices[i & InputMask] * in.Vector4s[i & InputMask]);
+        });
+
+        runner.Run("Matrix4f::Transform(Vector3f)", "scalar", [&in](std::size_t i)
+        {
+            DoNotOptimise(Scalar::Transform(in.Matrices[i & InputMask], in.Vector3s[i & InputMask]));
+        });
+
+        runner.Run("Matrix4f::Transform(Vector3f)", SIMDInstructionSet, [&in](std::size_t i)
+        {
+            Vector3f vector = in.Vector3s[i & InputMask];
+            in.Matrices[i & InputMask].Transform(vector);
+            DoNotOptimise(vector);
+        });
+
+        runner.Run("Matrix4f::GetDeterminant", "scalar", [&in](std::size_t i)
+        {
+            DoNotOptimise(Scalar::GetDeterminant(in.Matrices[i & InputMask]));
+        });
+
+        runner.Run("Matrix4f::GetDeterminant", SIMDInstructionSet, [&in](std::size_t i)
+        {
+            DoNotOptimise(in.Matrices[i & InputMask].GetDeterminant());
+        });
+
+        // the inverse used to be the adjoint built from sixteen 3x3 minors divided by the determinant
+        runner.Run("Matrix4f::GetInverse", "scalar", [&in](std::size_t i)
+        {
+            const Matrix4f& matrix = in.Matrices[i & InputMask];
+            Matrix4f inverse = matrix.GetAdjoint();
+            inverse.Multiply(1 / Scalar::GetDeterminant(matrix));
+            DoNotOptimise(inverse);
+        });
+
+        runner.Run("Matrix4f::GetInverse", SIMDInstructionSet, [&in](std::size_t i)
+        {
+            DoNotOptimise(in.Matrices[i & InputMask].GetInverse());
+        });
+
+        runner.Run("Matrix4f::Transpose", "scalar", [&in](std::size_t i)
+        {
+            DoNotOptimise(Scalar::Transpose(in.Matrices[i & InputMask]));
+        });
+
+        runner.Run("Matrix4f::Transpose", SIMDInstructionSet, [&in](std::size_t i)
+        {
+            Matrix4f matrix = in.Matrices[i & InputMask];
+            matrix.Transpose();
+            DoNotOptimise(matrix);
+        });
+
+        runner.Run("Matrix4f::ToArray", "scalar", [&in](std::size_t i)
+        {
+            DoNotOptimise(in.Matrices[i & InputMask].ToArray());
+        });
+    }
+
+    // each iteration transforms the whole input table, so these times are per 256 elements
+    void RunBatchBenchmarks(Benchmark::MicrobenchmarkRunner& runner, const MathInputs& in)
+    {
+        std::vector<Vector2f> vector2s(InputCount);
+        std::vector<Vector3f> vector3s(InputCount);
+        std::vector<Vector4f> vector4s(InputCount);
+        std::vector<Rectanglef> rectangles(InputCount);
+
+        runner.Run("Matrix4f::Transform(Vector2f[256])", "scalar", [&in, &vector2s](std::size_t i)
+        {
+            const Matrix4f& matrix = in.Matrices[i & InputMask];
+
+            for (std::size_t j = 0; j < InputCount; ++j)
+            {
+                vector2s[j] = Scalar::Transform(matrix, in.Vector2s[j]);
+            }
+
+            DoNotOptimise(vector2s.front());
+        });
+
+        runner.Run("Matrix4f::Transform(Vector2f[256])", SIMDInstructionSet, [&in, &vector2s](std::size_t i)
+        {
+            in.Matrices[i & InputMask].Transform(in.Vector2s.data(), vector2s.data(), InputCount);
+            DoNotOptimise(vector2s.front());
+        });
+
+        runner.Run("Matrix4f::Transform(Vector3f[256])", "scalar", [&in, &vector3s](std::size_t i)
+        {
+            const Matrix4f& matrix = in.Matrices[i & InputMask];
+
+            for (std::size_t j = 0; j < InputCount; ++j)
+            {
+                vector3s[j] = Scalar::Transform(matrix, in.Vector3s[j]);
+            }
+
+            DoNotOptimise(vector3s.front());
+        });
+
+        runner.Run("Matrix4f::Transform(Vector3f[256])", SIMDInstructionSet, [&in, &vector3s](std::size_t i)
+        {
+            in.Matrices[i & InputMask].Transform(in.Vector3s.data(), vector3s.data(), InputCount);
+            DoNotOptimise(vector3s.front());
+        });
+
+        runner.Run("Matrix4f::Transform(Vector4f[256])", "scalar", [&in, &vector4s](std::size_t i)
+        {
+            const Matrix4f& matrix = in.Matrices[i & InputMask];
+
+            for (std::size_t j = 0; j < InputCount; ++j)
+            {
+                vector4s[j] = Scalar::Transform(matrix, in.Vector4s[j]);
+            }
+
+            DoNotOptimise(vector4s.front());
+        });
+
+        runner.Run("Matrix4f::Transform(Vector4f[256])", SIMDInstructionSet, [&in, &vector4s](std::size_t i)
+        {
+            in.Matrices[i & InputMask].Transform(in.Vector4s.data(), vector4s.data(), InputCount);
+            DoNotOptimise(vector4s.front());
+        });
+
+        runner.Run("Matrix4f::TransformBounds(Rectanglef[256])", "scalar", [&in, &rectangles](std::size_t i)
+        {
+            const Matrix4f& matrix = in.Matrices[i & InputMask];
+
+            for (std::size_t j = 0; j < InputCount; ++j)
+            {
+                rectangles[j] = Scalar::TransformBounds(matrix, in.Rectangles[j]);
+            }
+
+            DoNotOptimise(rectangles.front());
+        });
+
+        runner.Run("Matrix4f::TransformBounds(Rectanglef[256])", SIMDInstructionSet, [&in, &rectangles](std::size_t i)
+        {
+            in.Matrices[i & InputMask].TransformBounds(in.Rectangles.data(), rectangles.data(), InputCount);
+            DoNotOptimise(rectangles.front());
+        });
+    }
+
+    void RunVectorBenchmarks(Benchmark::MicrobenchmarkRunner& runner, const MathInputs& in)
+    {
+        runner.Run("Vector2f::operator+", "scalar", [&in](std::size_t i)
+        {
+            DoNotOptimise(in.Vector2s[i & InputMask] + in.Vector2s[(i + 1) & InputMask]);
+        });
+
+        runner.Run("Vector2f::Dot", "scalar", [&in](std::size_t i)
+        {
+            DoNotOptimise(in.Vector2s[i & InputMask].Dot(in.Vector2s[(i + 1) & InputMask]));
+        });
+
+        runner.Run("Vector2f::Normalise", "scalar", [&in](std::size_t i)
+        {
+            Vector2f vector = in.Vector2s[i & InputMask];
+            vector.Normalise();
+            DoNotOptimise(vector);
+        });
+
+        runner.Run("Vector2f::Lerp", "scalar", [&in](std::size_t i)
+        {
+            DoNotOptimise(Vector2f::Lerp(in.Vector2s[i & InputMask], in.Vector2s[(i + 1) & InputMask], in.Fractions[i & InputMask]));
+        });
+
+        runner.Run("Vector2f::ToArray", "scalar", [&in](std::size_t i)
+        {
+            DoNotOptimise(in.Vector2s[i & InputMask].ToArray());
+        });
+
+        runner.Run("Vector3f::Cross", "scalar", [&in](std::size_t i)
+        {
+            DoNotOptimise(in.Vector3s[i & InputMask].Cross(in.Vector3s[(i + 1) & InputMask]));
+        });
+
+        runner.Run("Vector3f::Normalise", "scalar", [&in](std::size_t i)
+        {
+            Vector3f vector = in.Vector3s[i & InputMask];
+            vector.Normalise();
+            DoNotOptimise(vector);
+        });
+
+        runner.Run("Vector4f::operator+", "scalar", [&in](std::size_t i)
+        {
+            DoNotOptimise(in.Vector4s[i & InputMask] + in.Vector4s[(i + 1) & InputMask]);
+        });
+
+        runner.Run("Vector4f::Dot", "scalar", [&in](std::size_t i)
+        {
+            DoNotOptimise(in.Vector4s[i & InputMask].Dot(in.Vector4s[(i + 1) & InputMask]));
+        });
+
+        runner.Run("Vector4f::ToArray", "scalar", [&in](std::size_t i)
+        {
+            DoNotOptimise(in.Vector4s[i & InputMask].ToArray());
+        });
+    }
+
+    void RunRectangleBenchmarks(Benchmark::MicrobenchmarkRunner& runner, const MathInputs& in)
+    {
+        runner.Run("Rectanglef::Intersects", "scalar", [&in](std::size_t i)
+        {
+            DoNotOptimise(in.Rectangles[i & InputMask].Intersects(in.Rectangles[(i + 1) & InputMask]));
+        });
+
+        runner.Run("Rectanglef::Contains(Vector2f)", "scalar", [&in](std::size_t i)
+        {
+            DoNotOptimise(in.Rectangles[i & InputMask].Contains(in.Vector2s[i & InputMask]));
+        });
+    }
+
+    void RunColourBenchmarks(Benchmark::MicrobenchmarkRunner& runner, const MathInputs& in)
+    {
+        // only RGB to HSV/HSL through the component getters and HSV to RGB through SetHSV are implemented
+        runner.Run("Colour::SetHSV", "scalar", [&in](std::size_t i)
+        {
+            Colour colour;
+            colour.SetHSV(in.Hues[i & InputMask], in.Fractions[i & InputMask], in.Fractions[(i + 1) & InputMask], 1.0f);
+            DoNotOptimise(colour);
+        });
+
+        runner.Run("Colour::GetHSV", "scalar", [&in](std::size_t i)
+        {
+            const Colour& colour = in.Colours[i & InputMask];
+            DoNotOptimise(Vector3f((float)colour.GetHue(), colour.GetHSVSaturation(), colour.GetHSVValue()));
+        });
+
+        runner.Run("Colour::GetHSL", "scalar", [&in](std::size_t i)
+        {
+            const Colour& colour = in.Colours[i & InputMask];
+            DoNotOptimise(Vector3f((float)colour.GetHue(), colour.GetHSLSaturation(), colour.GetHSLLuminance()));
+        });
+
+        runner.Run("Colour::Lerp", "scalar", [&in](std::size_t i)
+        {
+            DoNotOptimise(Colour::Lerp(in.Colours[i & InputMask], in.Colours[(i + 1) & InputMask], in.Fractions[i & InputMask]));
+        });
+    }
+}
+
+int main(int argc, char** argv)
+{
+    Benchmark::MicrobenchmarkRunner runner;
+    std::string output;
+
+    try
+    {
+        for (int i = 1; i < argc; ++i)
+        {
+            std::string arg = argv[i];
+
+            if (i + 1 >= argc)
+            {
+                throw std::runtime_error("Missing value for " + arg);
+            }
+            else if (arg == "-o")
+            {
+                output = argv[++i];
+            }
+            else if (arg == "--repetitions")
+            {
+                runner.Repetitions = Benchmark::ParseCount(arg, argv[++i]);
+            }
+            else if (arg == "--min-time-ms")
+            {
+                runner.MinimumSeconds = Benchmark::ParseCount(arg, argv[++i]) / 1000.0;
+            }
+            else if (arg == "--filter")
+            {
+                runner.Filter = argv[++i];
+            }
+            else
+            {
+                throw std::runtime_error("Unknown option " + arg);
+            }
+        }
+
+        MathInputs inputs;
+        RunMatrixBenchmarks(runner, inputs);
+        RunBatchBenchmarks(runner, inputs);
+        RunVectorBenchmarks(runner, inputs);
+        RunRectangleBenchmarks(runner, inputs);
+        RunColourBenchmarks(runner, inputs);
+
+        std::string json = runner.ToJSON("math");
+
+        if (output.empty())
+        {
+            std::cout << json;
+        }
+        else
+        {
+            std::ofstream file(output);
+
+            if (!(file << json))
+            {
+                throw std::runtime_error("Couldn't write " + output);
+            }
+        }
+    }
+    catch (const Exception& e)
+    {
+        std::cerr << e.GetMessage() << "\n";
+        return 1;
+    }
+    catch (const std::exception& e)
+    {
+        std::cerr << e.what() << "\n";
+        return 1;
+    }
+
+    return 0;
+}
\ No newline at end of file
@@ -0,0 +1,455 @@
+/**
+ * @file SpriteBenchmarks.cpp
+ * @brief FaceEngineBenchmarks, measures SpriteBatcher throughput in an offscreen game and writes the results as JSON.
+ *
+ * Usage: FaceEngineBenchmarks [-o <output.json>] [--sprites <count>] [--frames <count>] [--warmup <count>] [--scenario <name>]
+ *
+ * Every scenario draws the same number of 32x32 sprites per frame into a 1280x720 offscreen framebuffer. Frame times are measured
+ * between the starts of consecutive draws, so they include presenting the frame. Results go to standard output without -o.
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "Benchmark.h"
+#include "FaceEngine/Game.h"
+#include "FaceEngine/Graphics/SpriteBatcher.h"
+#include "FaceEngine/Graphics/Texture2D.h"
+#include "FaceEngine/Graphics/TextureAtlas.h"
+#include "FaceEngine/Graphics/TextureFont.h"
+
+using namespace FaceEngine;
+
+namespace
+{
+    constexpr std::uint32_t SpriteSize = 32;
+    constexpr std::uint32_t TextureCount = 64;
+    constexpr std::uint32_t GlyphWidth = 8;
+    constexpr std::uint32_t GlyphHeight = 12;
+    constexpr std::size_t LineLength = 120;
+
+    enum Scenario
+    {
+        ScenarioSingleTextureStatic,
+        ScenarioSingleTextureDynamic,
+        ScenarioManyTextures,
+        ScenarioManyTexturesAtlas,
+        ScenarioRotated,
+        ScenarioText,
+        ScenarioCount
+    };
+
+    const char* ScenarioNames[ScenarioCount] =
+    {
+        "single_texture_static",
+        "single_texture_dynamic",
+        "many_textures",
+        "many_textures_atlas",
+        "rotated",
+        "text"
+    };
+
+    struct BenchmarkOptions
+    {
+        std::string Output;
+        std::string Filter;
+        std::size_t Sprites = 10000;
+        std::size_t Frames = 300;
+        std::size_t Warmup = 30;
+    };
+
+    struct ScenarioResult
+    {
+        Scenario Type;
+        std::size_t Frames;
+        double Seconds;
+        SpriteBatcherStatistics Statistics;
+        std::vector<double> FrameTimes;
+    };
+
+    std::vector<std::uint8_t> CreateImage(std::uint32_t width, std::uint32_t height, std::uint32_t seed)
+    {
+        std::vector<std::uint8_t> pixels(width * height * 4);
+
+        for (std::uint32_t y = 0; y < height; ++y)
+        {
+            for (std::uint32_t x = 0; x < width; ++x)
+            {
+                std::uint8_t* pixel = &pixels[(y * width + x) * 4];
+                pixel[0] = (std::uint8_t)(x * 8 + seed * 37);
+                pixel[1] = (std::uint8_t)(y * 8 + seed * 91);
+                pixel[2] = (std::uint8_t)(seed * 53);
+                pixel[3] = (x + y) % 4 == 0 ? 0 : 255;
+            }
+        }
+
+        return pixels;
+    }
+
+    class SpriteBenchmark : public Game
+    {
+    private:
+        BenchmarkOptions options;
+        std::vector<Scenario> scenarios;
+        std::vector<ScenarioResult> results;
+        std::string renderer;
+
+        SpriteBatcher* spriteBatcher = nullptr;
+        std::vector<Texture2D*> textures;
+        TextureAtlas* atlas = nullptr;
+        std::vector<Texture2D*> atlasTextures;
+        TextureFont* font = nullptr;
+        std::vector<std::string> lines;
+        std::vector<Rectanglef> positions;
+
+        std::size_t current = 0;
+        std::size_t frame = 0;
+        std::vector<double> frameTimes;
+        std::chrono::steady_clock::time_point start;
+        std::chrono::steady_clock::time_point previous;
+        std::chrono::steady_clock::time_point last;
+
+        void CreateFont()
+        {
+            std::vector<FontChar> fontChars;
+            std::vector<std::uint8_t> glyph(GlyphWidth * GlyphHeight * 4);
+
+            for (std::uint32_t c = 32; c < 127; ++c)
+            {
+                Texture2D* texture = nullptr;
+
+                if (c != ' ')
+                {
+                    for (std::size_t i = 0; i < glyph.size(); i += 4)
+                    {
+                        glyph[i] = glyph[i + 1] = glyph[i + 2] = 255;
+                        glyph[i + 3] = ((i / 4) * 7 + c) % 3 == 0 ? 0 : 255;
+                    }
+
+                    texture = atlas->Add(GlyphWidth, GlyphHeight, glyph.data());
+                }
+
+                fontChars.emplace_back(c, 0, GlyphHeight, GlyphWidth + 1, texture);
+            }
+
+            // the font shares the sprite atlas, so it is disposed with the font
+            font = TextureFont::CreateTextureFont(ResourceManagerPtr, GlyphHeight, GlyphHeight * 64, 0, GlyphHeight + 2, fontChars, atlas);
+        }
+
+        void Reset()
+        {
+            // the same pseudo-random layout for every scenario and every run
+            const Resolution& resolution = WindowPtr->GetResolution();
+            std::uint32_t state = 12345;
+            positions.clear();
+
+            for (std::size_t i = 0; i < options.Sprites; ++i)
+            {
+                state = state * 1664525 + 1013904223;
+                float x = (float)(state % (resolution.GetWidth() - SpriteSize));
+                state = state * 1664525 + 1013904223;
+                float y = (float)(state % (resolution.GetHeight() - SpriteSize));
+                positions.emplace_back(x, y, SpriteSize, SpriteSize);
+            }
+
+            spriteBatcher->ResetStatistics();
+        }
+
+        void DrawScenario(Scenario scenario)
+        {
+            spriteBatcher->Begin();
+
+            switch (scenario)
+            {
+                case ScenarioSingleTextureDynamic:
+                    for (std::size_t i = 0; i < positions.size(); ++i)
+                    {
+                        Rectanglef& rect = positions[i];
+                        rect.X = std::fmod(rect.X + 1.0f + i % 3, (float)(WindowPtr->GetResolution().GetWidth() - SpriteSize));
+                        spriteBatcher->Draw(textures[0], rect);
+                    }
+                    break;
+                case ScenarioManyTextures:
+                    // neighbouring sprites never share a texture, so every sprite is its own draw call
+                    for (std::size_t i = 0; i < positions.size(); ++i)
+                    {
+                        spriteBatcher->Draw(textures[i % TextureCount], positions[i]);
+                    }
+                    break;
+                case ScenarioManyTexturesAtlas:
+                    for (std::size_t i = 0; i < positions.size(); ++i)
+                    {
+                        spriteBatcher->Draw(atlasTextures[i % TextureCount], positions[i]);
+                    }
+                    break;
+                case ScenarioRotated:
+                    for (std::size_t i = 0; i < positions.size(); ++i)
+                    {
+                        spriteBatcher->Draw(textures[0], positions[i], ((frame + i) % 628) / 100.0f, Colour::White);
+                    }
+                    break;
+                case ScenarioText:
+                    for (std::size_t i = 0; i < lines.size(); ++i)
+                    {
+                        float y = (float)(i * (GlyphHeight + 2) % (WindowPtr->GetResolution().GetHeight() - GlyphHeight));
+                        spriteBatcher->DrawString(font, lines[i], Vector2f(0.0f, y), Colour::White);
+                    }
+                    break;
+                default:
+                    for (const Rectanglef& rect : positions)
+                    {
+                        spriteBatcher->Draw(textures[0], rect);
+                    }
+                    break;
+            }
+
+            spriteBatcher->End();
+        }
+
+        void Finish()
+        {
+            ScenarioResult result;
+            result.Type = scenarios[current];
+            result.Frames = options.Frames;
+            result.Seconds = std::chrono::duration<double>(last - start).count();
+            result.Statistics = spriteBatcher->GetStatistics();
+            result.FrameTimes = std::move(frameTimes);
+            results.push_back(std::move(result));
+            frameTimes.clear();
+        }
+    public:
+        SpriteBenchmark(const BenchmarkOptions& o)
+        {
+            options = o;
+            Offscreen = true;
+            OffscreenResolution = Resolution(1280, 720);
+
+            for (int i = 0; i < ScenarioCount; ++i)
+            {
+                if (options.Filter.empty() || options.Filter == ScenarioNames[i])
+                {
+                    scenarios.push_back((Scenario)i);
+                }
+            }
+
+            // text lines are sized so the text scenario draws roughly as many glyphs as the others draw sprites
+            std::size_t glyphs = 0;
+
+            for (std::size_t i = 0; glyphs < options.Sprites; ++i)
+            {
+                std::string line;
+
+                for (std::size_t j = 0; j < LineLength && glyphs < options.Sprites; ++j)
+                {
+                    char c = (char)(33 + (i * 31 + j * 7) % 94);
+                    line += c;
+                    ++glyphs;
+                }
+
+                lines.push_back(std::move(line));
+            }
+        }
+
+        inline bool HasScenarios() const noexcept { return !scenarios.empty(); }
+
+        void Initialise() override
+        {
+            renderer = (const char*)glGetString(GL_RENDERER);
+            spriteBatcher = SpriteBatcher::CreateSpriteBatcher(ResourceManagerPtr, WindowPtr);
+            atlas = TextureAtlas::CreateTextureAtlas(ResourceManagerPtr, 1024, 1024);
+
+            for (std::uint32_t i = 0; i < TextureCount; ++i)
+            {
+                std::vector<std::uint8_t> image = CreateImage(SpriteSize, SpriteSize, i);
+                textures.push_back(Texture2D::CreateTexture2D(ResourceManagerPtr, SpriteSize, SpriteSize, image.data()));
+                atlasTextures.push_back(atlas->Add(SpriteSize, SpriteSize, image.data()));
+            }
+
+            CreateFont();
+            Reset();
+        }
+
+        void Draw() override
+        {
+            std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+
+            // the frame before this one was the last measured frame of the scenario
+            if (frame == options.Warmup + options.Frames)
+            {
+                last = now;
+                frameTimes.push_back(std::chrono::duration<double, std::milli>(now - previous).count());
+                Finish();
+                frame = 0;
+
+                if (++current == scenarios.size())
+                {
+                    Exit();
+                    return;
+                }
+
+                Reset();
+            }
+            else if (frame > options.Warmup)
+            {
+                frameTimes.push_back(std::chrono::duration<double, std::milli>(now - previous).count());
+            }
+
+            if (frame == options.Warmup)
+            {
+                start = now;
+                spriteBatcher->ResetStatistics();
+            }
+
+            previous = now;
+            WindowPtr->Clear(Colour::Black);
+            DrawScenario(scenarios[current]);
+            ++frame;
+        }
+
+        void OnExit() override
+        {
+            ResourceManagerPtr->DisposeResource(font);
+
+            for (Texture2D* texture : textures)
+            {
+                ResourceManagerPtr->DisposeResource(texture);
+            }
+
+            ResourceManagerPtr->DisposeResource(spriteBatcher);
+        }
+
+        std::string ToJSON() const
+        {
+            std::string json;
+            char buffer[512];
+
+            // the renderer string comes from the driver, so it's escaped rather than formatted into the fixed-size buffer
+            json += "{\n  \"benchmark\": \"sprites\",\n  \"renderer\": \"" + EscapeJSON(renderer) + "\",";
+            std::snprintf(buffer, sizeof(buffer), "\n  \"width\": %u,\n  \"height\": %u,\n  \"spriteSize\": %u,\n  \"scenarios\": [",
+                OffscreenResolution.GetWidth(), OffscreenResolution.GetHeight(), SpriteSize);
+            json += buffer;
+
+            for (std::size_t i = 0; i < results.size(); ++i)
+            {
+                const ScenarioResult& result = results[i];
+                std::vector<double> sorted = result.FrameTimes;
+                std::sort(sorted.begin(), sorted.end());
+
+                double mean = 0.0;
+
+                for (double time : sorted)
+                {
+                    mean += time;
+                }
+
+                mean = sorted.empty() ? 0.0 : mean / sorted.size();
+
+                std::snprintf(buffer, sizeof(buffer),
+                    "%s\n    {\n      \"name\": \"%s\",\n      \"frames\": %zu,\n      \"spritesPerFrame\": %.1f,\n      \"spritesPerSecond\": %.1f,\n"
+                    "      \"drawCallsPerFrame\": %.2f,\n      \"uploadsPerFrame\": %.2f,\n      \"bytesUploadedPerFrame\": %.1f,\n",
+                    i > 0 ? "," : "", ScenarioNames[result.Type], result.Frames,
+                    (double)result.Statistics.Sprites / result.Frames,
+                    result.Seconds > 0.0 ? result.Statistics.Sprites / result.Seconds : 0.0,
+                    (double)result.Statistics.DrawCalls / result.Frames,
+                    (double)result.Statistics.Uploads / result.Frames,
+                    (double)result.Statistics.BytesUploaded / result.Frames);
+                json += buffer;
+
+                std::snprintf(buffer, sizeof(buffer),
+                    "      \"frameTimeMs\": { \"mean\": %.4f, \"min\": %.4f, \"p50\": %.4f, \"p90\": %.4f, \"p95\": %.4f, \"p99\": %.4f, \"max\": %.4f }\n    }",
+                    mean, sorted.empty() ? 0.0 : sorted.front(), Benchmark::Percentile(sorted, 50.0), Benchmark::Percentile(sorted, 90.0),
+                    Benchmark::Percentile(sorted, 95.0), Benchmark::Percentile(sorted, 99.0), sorted.empty() ? 0.0 : sorted.back());
+                json += buffer;
+            }
+
+            json += "\n  ]\n}\n";
+            return json;
+        }
+    };
+}
+
+int main(int argc, char** argv)
+{
+    BenchmarkOptions options;
+
+    try
+    {
+        for (int i = 1; i < argc; ++i)
+        {
+            std::string arg = argv[i];
+
+            if (i + 1 >= argc)
+            {
+                throw std::runtime_error("Missing value for " + arg);
+            }
+            else if (arg == "-o")
+            {
+                options.Output = argv[++i];
+            }
+            else if (arg == "--sprites")
+            {
+                options.Sprites = Benchmark::ParseCount(arg, argv[++i]);
+            }
+            else if (arg == "--frames")
+            {
+                options.Frames = Benchmark::ParseCount(arg, argv[++i]);
+            }
+            else if (arg == "--warmup")
+            {
+                options.Warmup = Benchmark::ParseCount(arg, argv[++i], true);
+            }
+            else if (arg == "--scenario")
+            {
+                options.Filter = argv[++i];
+            }
+            else
+            {
+                throw std::runtime_error("Unknown option " + arg);
+            }
+        }
+
+        SpriteBenchmark benchmark(options);
+
+        if (!benchmark.HasScenarios())
+        {
+            throw std::runtime_error("No scenario is named " + options.Filter);
+        }
+
+        benchmark.Run();
+        std::string json = benchmark.ToJSON();
+
+        if (options.Output.empty())
+        {
+            std::cout << json;
+        }
+        else
+        {
+            std::ofstream file(options.Output);
+
+            if (!(file << json))
+            {
+                throw std::runtime_error("Couldn't write " + options.Output);
+            }
+        }
+    }
+    catch (const Exception& e)
+    {
+        std::cerr << e.GetMessage() << "\n";
+        return 1;
+    }
+    catch (const std::exception& e)
+    {
+        std::cerr << e.what() << "\n";
+        return 1;
+    }
+
+    return 0;
+}
\ No newline at end of file
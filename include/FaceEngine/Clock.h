@@ -0,0 +1,84 @@
+#ifndef FACEENGINE_CLOCK_H_
+#define FACEENGINE_CLOCK_H_
+
+#include <chrono>
+
+namespace FaceEngine
+{
+    /**
+     * @brief A source of time for the game loop, in seconds.
+     *
+     * Game uses a GLFWClock by default. Inject another clock with Game::SetClock to control the passage of time, such as with a ManualClock in tests.
+     */
+    class Clock
+    {
+    public:
+        virtual ~Clock() = default;
+
+        /**
+         * @brief Returns the current time in seconds. Only differences between times are meaningful.
+         */
+        virtual double GetTime() = 0;
+    };
+
+    /**
+     * @brief A clock reading the GLFW timer. GLFW must be initialised.
+     */
+    class GLFWClock : public Clock
+    {
+    public:
+        double GetTime() override;
+    };
+
+    /**
+     * @brief A clock reading the monotonic system clock, which doesn't need GLFW.
+     */
+    class SteadyClock : public Clock
+    {
+    private:
+        std::chrono::steady_clock::time_point start;
+    public:
+        inline SteadyClock() noexcept
+        {
+            start = std::chrono::steady_clock::now();
+        }
+
+        inline double GetTime() override
+        {
+            return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        }
+    };
+
+    /**
+     * @brief A clock that only moves when it is advanced, for deterministic simulation.
+     *
+     * A headless game running in fast-forward mode advances its ManualClock by the timestep after every update.
+     */
+    class ManualClock : public Clock
+    {
+    private:
+        double time;
+    public:
+        inline ManualClock(double t = 0.0) noexcept
+        {
+            time = t;
+        }
+
+        inline double GetTime() override
+        {
+            return time;
+        }
+
+        inline void SetTime(double t) noexcept
+        {
+            time = t;
+        }
+
+        inline void Advance(double seconds) noexcept
+        {
+            time += seconds;
+        }
+    };
+}
+
+#endif
\ No newline at end of file
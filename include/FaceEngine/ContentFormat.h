@@ -0,0 +1,48 @@
+#ifndef FACEENGINE_CONTENTFORMAT_H_
+#define FACEENGINE_CONTENTFORMAT_H_
+
+#include <cstdint>
+#include <array>
+
+namespace FaceEngine
+{
+    /**
+     * @brief The type of content stored in a Face Engine content file, written after the header and version.
+     */
+    enum ContentFileType : std::uint8_t
+    {
+        TypeTexture2D = 1,
+        TypeTextureFont = 2,
+        TypePack = 3
+    };
+
+    /**
+     * @brief The Face Engine content file versions.
+     *
+     * Version 1 is used for every content type. Version 2 is only used by Texture2D content and stores the image as independently deflated row bands.
+     */
+    enum ContentFileVersion : std::uint8_t
+    {
+        ContentFileVersion1 = 1,
+        ContentFileVersion2 = 2
+    };
+
+    /**
+     * @brief Flags stored in version 2 Texture2D content files.
+     *
+     * TextureFlagMipmaps: the image data holds a precomputed mip chain after the base level, and the number of levels follows the band height.
+     * TextureFlagPremultiplied: the colour channels of the image data are premultiplied by alpha.
+     */
+    enum ContentTextureFlags : std::uint8_t
+    {
+        TextureFlagMipmaps = 0x01,
+        TextureFlagPremultiplied = 0x02
+    };
+
+    /**
+     * @brief The first 16 bytes of every Face Engine content file.
+     */
+    constexpr std::array<std::uint8_t, 16> ContentFileHeader = { 'F', 'E', 'C', 'F', 2, 3, 1, 0, 7, 2, 2, 2, 9, 6, 'E', 'W' };
+}
+
+#endif
\ No newline at end of file
@@ -2,51 +2,213 @@
 #define FACEENGINE_CONTENTLOADER_H_
 
 #include <cstdint>
+#include <cstddef>
+#include <cstdio>
 #include <array>
+#include <functional>
+#include <memory>
+#include <string>
+#include <unordered_map>
 
+#include "FaceEngine/ContentFormat.h"
+#include "FaceEngine/JobSystem.h"
 #include "FaceEngine/ResourceManager.h"
 #include "FaceEngine/Graphics/Texture2D.h"
+#include "FaceEngine/Graphics/TextureAtlas.h"
 #include "FaceEngine/Graphics/TextureFont.h"
 
 namespace FaceEngine
 {
-    enum ContentFileType : std::uint8_t
+    /**
+     * @brief The time ContentLoader spent in each phase of loading a single asset, passed to the load tracer.
+     *
+     * ReadSeconds covers opening, reading and parsing the file, and anything else not covered by another phase.
+     * InflateSeconds covers decompression, which is wall time when the bands of a texture are inflated in parallel.
+     * ExpandSeconds covers converting font glyph coverage to RGBA. UploadSeconds covers creating textures or adding them to an atlas,
+     * which is the time spent submitting the data to OpenGL; the driver may finish the upload later.
+     */
+    struct ContentLoadTrace
     {
-        TypeTexture2D = 1,
-        TypeTextureFont = 2
+        std::string Path;
+        std::string Entry;
+        ContentFileType Type;
+
+        // bytes read from the content file or pack entry, and bytes of RGBA data uploaded
+        std::uint64_t FileBytes = 0;
+        std::uint64_t TextureBytes = 0;
+
+        double ReadSeconds = 0.0;
+        double InflateSeconds = 0.0;
+        double ExpandSeconds = 0.0;
+        double UploadSeconds = 0.0;
+        double TotalSeconds = 0.0;
     };
 
     class ContentLoader : public Resource
     {
         friend class Game;
     private:
+        struct CacheEntry
+        {
+            // a handle rather than a pointer, so content disposed through the ResourceManager directly is detected as stale
+            ResourceHandle Content;
+            std::uint32_t References;
+        };
+
         ResourceManager* resMan;
+        JobSystem* jobs;
+        std::unordered_map<std::string, CacheEntry> cache;
+        std::unordered_map<ResourceHandle, std::string> cacheKeys;
+        std::function<void(const ContentLoadTrace&)> tracer;
 
-        inline ContentLoader(ResourceManager* rm) noexcept
+        inline ContentLoader(ResourceManager* rm, JobSystem* js) noexcept
         {
             resMan = rm;
+            jobs = js;
         }
 
         static std::uint32_t BytesToInt32(const std::array<std::uint8_t, 4>&) noexcept;
 
-        std::array<std::uint8_t, 16> contentFileHeader = { 'F', 'E', 'C', 'F', 2, 3, 1, 0, 7, 2, 2, 2, 9, 6, 'E', 'W' };
-        std::uint8_t contentFileVersion = 1;
-
         bool IsValidHeader(const std::uint8_t*) const noexcept;
+
+        void SeekPackEntry(std::FILE*, const std::string&, const std::string&) const;
+        std::uint8_t* ReadTexture2D(std::FILE*, std::uint32_t&, std::uint32_t&, std::uint32_t&, std::uint8_t&, ContentLoadTrace*) const;
+        std::unique_ptr<std::uint8_t[]> ReadTexture2D(const std::string&, const std::string&, std::uint32_t&, std::uint32_t&, std::uint32_t&, std::uint8_t&, ContentLoadTrace*) const;
+        Texture2D* CreateContentTexture2D(const std::string&, const std::string&, const TextureOptions&, ContentLoadTrace*) const;
+        Texture2D* CreateAtlasTexture2D(const std::string&, const std::string&, TextureAtlas*, ContentLoadTrace*) const;
+        TextureFont* ReadTextureFont(std::FILE*, ContentLoadTrace*) const;
+        TextureFont* CreateContentTextureFont(const std::string&, const std::string&, ContentLoadTrace*) const;
+
+        static bool Inflate(const std::uint8_t*, std::size_t, std::uint8_t*, std::size_t) noexcept;
+        bool InflateBands(const std::uint8_t*, const std::uint32_t*, std::uint32_t, std::uint8_t*, std::size_t, std::size_t) const;
+
+        static std::string ContentTag(const std::string&, const std::string&);
+        static std::string CacheKey(const std::string&, const std::string& = std::string());
+
+        template <typename T, typename F>
+        T* Acquire(const std::string&, const char*, F);
+
+        template <typename F>
+        auto Trace(const std::string&, const std::string&, ContentFileType, F) const;
     public:
         /**
          * @brief Loads a Texture2D from a Face Engine content file specified by the path.
          * 
+         * Both version 1 files (a single deflate stream) and version 2 files (independently deflated row bands) are supported.
+         * The bands of a version 2 file are inflated in parallel.
+         * The texture is evictable and is reloaded from the file if it is drawn after being evicted.
+         * 
          * @return Texture2D* A pointer to the newly created Texture2D.
          */
         Texture2D* LoadTexture2D(const std::string&) const;
 
+        /**
+         * @brief Loads a Texture2D from a Face Engine content file with the given sampling options.
+         * 
+         * If mipmaps are requested and the content file holds a precomputed mip chain it is uploaded as is, otherwise the mip chain is generated.
+         * 
+         * @return Texture2D* A pointer to the newly created Texture2D.
+         */
+        Texture2D* LoadTexture2D(const std::string&, const TextureOptions&) const;
+
+        /**
+         * @brief Loads a Texture2D from an entry of a Face Engine pack file with the given sampling options.
+         * 
+         * @return Texture2D* A pointer to the newly created Texture2D.
+         */
+        Texture2D* LoadTexture2D(const std::string&, const std::string&, const TextureOptions&) const;
+
+        /**
+         * @brief Loads a Texture2D from a Face Engine content file and packs it into a TextureAtlas, so it can be batched with other sprites in the atlas.
+         * 
+         * @return Texture2D* A pointer to the region of the atlas the texture was packed into.
+         */
+        Texture2D* LoadTexture2D(const std::string&, TextureAtlas*) const;
+
+        /**
+         * @brief Loads a Texture2D from an entry of a Face Engine pack file and packs it into a TextureAtlas.
+         * 
+         * @return Texture2D* A pointer to the region of the atlas the texture was packed into.
+         */
+        Texture2D* LoadTexture2D(const std::string&, const std::string&, TextureAtlas*) const;
+
         /**
          * @brief Loads a TextureFont from a Face Engine content file specified by the path.
          * 
+         * The glyphs of the font are packed into a TextureAtlas owned by the font.
+         * 
          * @return TextureFont* A pointer to the newly created TextureFont.
          */
         TextureFont* LoadTextureFont(const std::string&) const;
+
+        /**
+         * @brief Loads a Texture2D from an entry of a Face Engine pack file.
+         * 
+         * @return Texture2D* A pointer to the newly created Texture2D.
+         */
+        Texture2D* LoadTexture2D(const std::string&, const std::string&) const;
+
+        /**
+         * @brief Loads a TextureFont from an entry of a Face Engine pack file.
+         * 
+         * @return TextureFont* A pointer to the newly created TextureFont.
+         */
+        TextureFont* LoadTextureFont(const std::string&, const std::string&) const;
+
+        /**
+         * @brief Returns a shared Texture2D for the content file specified by the path, loading it only if it isn't already cached.
+         * 
+         * Every call must be paired with a call to Release(Resource*); the texture is disposed when its last reference is released.
+         * If shared content is disposed through the ResourceManager directly, its cache entry is dropped and the next call loads it again.
+         * 
+         * @return Texture2D* A pointer to the shared Texture2D.
+         */
+        Texture2D* AcquireTexture2D(const std::string&);
+
+        /**
+         * @brief Returns a shared Texture2D for an entry of a pack file, loading it only if it isn't already cached.
+         * 
+         * @return Texture2D* A pointer to the shared Texture2D.
+         */
+        Texture2D* AcquireTexture2D(const std::string&, const std::string&);
+
+        /**
+         * @brief Returns a shared TextureFont for the content file specified by the path, loading it only if it isn't already cached.
+         * 
+         * @return TextureFont* A pointer to the shared TextureFont.
+         */
+        TextureFont* AcquireTextureFont(const std::string&);
+
+        /**
+         * @brief Returns a shared TextureFont for an entry of a pack file, loading it only if it isn't already cached.
+         * 
+         * @return TextureFont* A pointer to the shared TextureFont.
+         */
+        TextureFont* AcquireTextureFont(const std::string&, const std::string&);
+
+        /**
+         * @brief Releases a reference to shared content, disposing it when no references remain.
+         * 
+         * @return true If the resource was shared content.
+         * @return false If the resource wasn't acquired from this ContentLoader.
+         */
+        bool Release(Resource*);
+
+        /**
+         * @brief Returns the number of references held to shared content, or zero if the resource isn't shared content.
+         */
+        std::uint32_t GetReferenceCount(const Resource*) const noexcept;
+
+        /**
+         * @brief Sets a function called with the phase breakdown of every asset loaded afterwards, or stops tracing if the function is empty.
+         * 
+         * Every LoadTexture2D and LoadTextureFont call is traced, including the loads of Acquire calls that miss the cache.
+         * Evicted textures reloaded from their content file aren't traced. Loads aren't timed while no tracer is set.
+         */
+        inline void SetLoadTracer(std::function<void(const ContentLoadTrace&)> t)
+        {
+            tracer = std::move(t);
+        }
     };
 }
 
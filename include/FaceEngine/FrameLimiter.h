@@ -0,0 +1,49 @@
+#ifndef FACEENGINE_FRAMELIMITER_H_
+#define FACEENGINE_FRAMELIMITER_H_
+
+namespace FaceEngine
+{
+    /**
+     * @brief Waits for frame deadlines without burning a core, by sleeping until shortly before the deadline and spinning for the rest.
+     *
+     * How long before the deadline to stop sleeping is learned from how far past their requested time previous sleeps woke up,
+     * so the spin stays as short as the operating system's scheduler allows while still waking up on time.
+     */
+    class FrameLimiter
+    {
+    private:
+        // running estimates of the mean and variance of sleep overshoot, in seconds
+        double overshootMean;
+        double overshootVariance;
+        double lastError;
+
+        static constexpr double MinSleep = 0.0005;
+        static constexpr double Smoothing = 0.1;
+    public:
+        FrameLimiter() noexcept;
+        ~FrameLimiter();
+
+        FrameLimiter(const FrameLimiter&) = delete;
+        FrameLimiter& operator=(const FrameLimiter&) = delete;
+
+        /**
+         * @brief Waits until the given number of seconds have passed. Waits of zero or less return immediately.
+         */
+        void Wait(double);
+
+        /**
+         * @brief Returns how long before a deadline sleeping stops and spinning begins, in seconds.
+         */
+        double GetSpinThreshold() const noexcept;
+
+        /**
+         * @brief Returns how many seconds the last wait finished after its deadline.
+         */
+        inline double GetLastError() const noexcept
+        {
+            return lastError;
+        }
+    };
+}
+
+#endif
\ No newline at end of file
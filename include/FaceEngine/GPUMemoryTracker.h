@@ -0,0 +1,99 @@
+#ifndef FACEENGINE_GPUMEMORYTRACKER_H_
+#define FACEENGINE_GPUMEMORYTRACKER_H_
+
+#include <array>
+#include <cstdint>
+#include <cstddef>
+
+namespace FaceEngine
+{
+    class Texture2D;
+
+    enum GPUMemoryCategory
+    {
+        GPUMemoryTextures,
+        GPUMemoryBuffers,
+        GPUMemoryOther,
+        GPUMemoryCategoryCount
+    };
+
+    /**
+     * @brief Tracks the video memory used by GPU resources and keeps it within a budget.
+     *
+     * The budget is a soft target: when an allocation would exceed it, evictable textures that haven't been drawn in the current frame
+     * are evicted, least recently drawn first. The limit is a hard ceiling: allocations that still exceed it after eviction throw an exception.
+     * A budget or limit of zero means no budget or limit. Eviction only happens when it is enabled.
+     */
+    class GPUMemoryTracker
+    {
+        friend class Texture2D;
+    private:
+        std::array<std::size_t, GPUMemoryCategoryCount> usage;
+        std::size_t budget;
+        std::size_t limit;
+        bool evictionEnabled;
+        std::uint64_t frame;
+        // resident evictable textures, least recently drawn first, linked through the textures themselves
+        Texture2D* leastRecentlyUsed;
+        Texture2D* mostRecentlyUsed;
+
+        bool EvictLeastRecentlyUsed() noexcept;
+        bool IsLinked(const Texture2D*) const noexcept;
+        void Link(Texture2D*) noexcept;
+        void Unlink(Texture2D*) noexcept;
+        void Touch(Texture2D*) noexcept;
+    public:
+        inline GPUMemoryTracker() noexcept
+        {
+            usage.fill(0);
+            budget = 0;
+            limit = 0;
+            evictionEnabled = false;
+            frame = 0;
+            leastRecentlyUsed = nullptr;
+            mostRecentlyUsed = nullptr;
+        }
+
+        /**
+         * @brief Records an allocation of video memory, evicting textures or throwing an exception if it exceeds the budget or limit.
+         */
+        void Allocate(GPUMemoryCategory, std::size_t);
+
+        /**
+         * @brief Records that video memory has been freed.
+         */
+        void Free(GPUMemoryCategory, std::size_t) noexcept;
+
+        /**
+         * @brief Advances the frame counter used to determine which textures were drawn least recently.
+         */
+        inline void NextFrame() noexcept { ++frame; }
+
+        inline std::uint64_t GetFrame() const noexcept { return frame; }
+
+        inline std::size_t GetUsage(GPUMemoryCategory category) const noexcept { return usage[category]; }
+
+        std::size_t GetTotalUsage() const noexcept;
+
+        inline std::size_t GetBudget() const noexcept { return budget; }
+
+        inline void SetBudget(std::size_t b) noexcept { budget = b; }
+
+        inline std::size_t GetLimit() const noexcept { return limit; }
+
+        inline void SetLimit(std::size_t l) noexcept { limit = l; }
+
+        inline bool IsEvictionEnabled() const noexcept { return evictionEnabled; }
+
+        inline void SetEvictionEnabled(bool enabled) noexcept { evictionEnabled = enabled; }
+
+        /**
+         * @brief Evicts least recently drawn textures until usage is within the budget.
+         *
+         * @return std::size_t The number of bytes freed.
+         */
+        std::size_t Trim() noexcept;
+    };
+}
+
+#endif
\ No newline at end of file
@@ -0,0 +1,111 @@
+#ifndef FACEENGINE_GPUPROFILER_H_
+#define FACEENGINE_GPUPROFILER_H_
+
+#include <atomic>
+#include <cstdint>
+#include <string>
+
+#include "FaceEngine/Profiler.h"
+
+#define GPU_PROFILER_MAX_PENDING_FRAMES 8UL
+
+/**
+ * @brief Times the GPU work submitted in the rest of the enclosing scope as a render pass with the given name, which must be a string literal.
+ *
+ * Must only be used on the thread that owns the OpenGL context. Define FACE_ENGINE_NO_PROFILER to compile every GPU profiling scope out entirely.
+ */
+#ifdef FACE_ENGINE_NO_PROFILER
+#define FACE_GPU_PROFILE_SCOPE(name)
+#else
+#define FACE_GPU_PROFILE_SCOPE(name) ::FaceEngine::GPUProfileScope FACE_PROFILE_CONCAT(__faceGPUProfileScope, __LINE__)(name)
+#endif
+
+namespace FaceEngine
+{
+    /**
+     * @brief Times render passes on the GPU with GL_TIME_ELAPSED queries and keeps a rolling average of each pass.
+     *
+     * Query results are read back once they are available, which is normally a few frames later, so reading them never stalls the pipeline.
+     * Only one GL_TIME_ELAPSED query can be active at a time, so passes nested in another pass are counted as part of the outer pass.
+     * A pass run several times in a frame, such as SpriteBatcher::End, is averaged as the total of the frame.
+     * While the CPU profiler is enabled, each pass is also recorded on a "GPU" track, starting when the pass was submitted.
+     * Recording is disabled by default.
+     */
+    class GPUProfiler
+    {
+    private:
+        static std::atomic_bool enabled;
+    public:
+        static inline bool IsEnabled() noexcept
+        {
+            return enabled.load(std::memory_order_relaxed);
+        }
+
+        static inline void SetEnabled(bool enable) noexcept
+        {
+            enabled.store(enable, std::memory_order_relaxed);
+        }
+
+        /**
+         * @brief Starts timing a render pass. Use FACE_GPU_PROFILE_SCOPE rather than calling this directly.
+         */
+        static void BeginPass(const char*);
+
+        /**
+         * @brief Stops timing the current render pass.
+         */
+        static void EndPass();
+
+        /**
+         * @brief Finishes the current frame and reads back the results of earlier frames that are available. Called by Game after every frame.
+         */
+        static void NextFrame();
+
+        /**
+         * @brief Returns the rolling average GPU time of a render pass per frame in milliseconds, or zero if it hasn't been timed.
+         */
+        static double GetAverage(const std::string&);
+
+        /**
+         * @brief Returns the rolling average GPU time of every timed pass per frame in milliseconds.
+         */
+        static double GetFrameAverage() noexcept;
+
+        /**
+         * @brief Deletes every query object. Called by Game before the OpenGL context is destroyed.
+         */
+        static void Release();
+    };
+
+    /**
+     * @brief Times the GPU work submitted during the lifetime of the object. Use FACE_GPU_PROFILE_SCOPE rather than constructing this directly.
+     */
+    class GPUProfileScope
+    {
+    private:
+        bool active;
+    public:
+        inline GPUProfileScope(const char* name)
+        {
+            active = GPUProfiler::IsEnabled();
+
+            if (active)
+            {
+                GPUProfiler::BeginPass(name);
+            }
+        }
+
+        inline ~GPUProfileScope()
+        {
+            if (active)
+            {
+                GPUProfiler::EndPass();
+            }
+        }
+
+        GPUProfileScope(const GPUProfileScope&) = delete;
+        GPUProfileScope& operator=(const GPUProfileScope&) = delete;
+    };
+}
+
+#endif
\ No newline at end of file
@@ -13,14 +13,18 @@
 #define FACEENGINE_GAME_H_
 
 #include <atomic>
+#include <vector>
 
 #include "FaceEngine/Exception.h"
 #include "FaceEngine/Window.h"
 #include "FaceEngine/ResourceManager.h"
+#include "FaceEngine/JobSystem.h"
 #include "FaceEngine/ContentLoader.h"
 #include "FaceEngine/GameUpdate.h"
 #include "FaceEngine/GameDraw.h"
 #include "FaceEngine/AudioDevice.h"
+#include "FaceEngine/Clock.h"
+#include "FaceEngine/RenderSnapshot.h"
 
 namespace FaceEngine
 {
@@ -33,11 +37,25 @@ namespace FaceEngine
     {
     private:
         static std::atomic_bool GameRunning;
+        std::atomic_bool headlessRunning { false };
+        std::atomic_bool exitRequested { false };
+        Clock* clock = nullptr;
+        JobSystem* jobSystem = nullptr;
+        std::vector<RenderSnapshotBase*> snapshots;
+
+        void RunHeadless();
+
+        void PollInput(bool);
+        void RunUpdate();
+        void RunDraw();
+        void Present();
+        void FlipSnapshots() noexcept;
+        void TrackJobSystem();
     protected:
         /**
          * @brief An interface for the graphics capabilities for the current computer.
          * 
-         * This object's allocation is automatic.
+         * This object's allocation is automatic. It is null in headless mode, along with WindowPtr, ContentLoaderPtr, GameDrawPtr and AudioDevicePtr.
          */
         GraphicsDevice* GraphicsDevicePtr;
 
@@ -55,6 +73,13 @@ namespace FaceEngine
          */
         Window* WindowPtr;
 
+        /**
+         * @brief Runs jobs on worker threads shared by the engine and the game, and queues jobs for the main thread.
+         * 
+         * Main thread jobs are run every frame before Draw(). This object's allocation is automatic, unless one is set with SetJobSystem.
+         */
+        JobSystem* JobSystemPtr;
+
         /**
          * @brief Loads game content from Face Engine content files.
          * 
@@ -85,6 +110,8 @@ namespace FaceEngine
 
         /**
          * @brief Determines the target speed of the Update() function. A value less than 1 indicates no limit.
+         * 
+         * Without a limit Update() runs once per iteration of the game loop, which is once per draw when drawing is limited by vsync or PreferredDraws.
          */
         double PreferredUpdates = 0.0;
 
@@ -92,6 +119,80 @@ namespace FaceEngine
          * @brief Determines the target speed of the Draw() function. A value less than 1 indicates no limit.
          */
         double PreferredDraws = 0.0;
+
+        /**
+         * @brief Determines whether Update() runs on a simulation thread while Draw() renders the previous update on the main thread.
+         * 
+         * In pipelined mode Update() for the next frame overlaps Draw() for the current one, so state shared between them must be handed over with a RenderSnapshot.
+         * Update() must then not make OpenGL calls, create or dispose resources or use the ResourceManager or ContentLoader, as those belong to the main thread.
+         * Input is polled once per frame, before Update() starts. This must be set before Run() is called.
+         */
+        bool Pipelined = false;
+
+        /**
+         * @brief Determines whether the game draws into an offscreen framebuffer instead of a window, such as for benchmarks and golden image tests.
+         * 
+         * Offscreen games are drawn exactly like windowed ones but get no input, aren't limited by vsync and are timed with a SteadyClock by default.
+         * Where FaceEngine is built with EGL they don't need a display server or GPU, so they run on Mesa's llvmpipe. Use Window::ReadPixels() to read frames back.
+         * Exit() is the only way to stop an offscreen game. This must be set before Run() is called.
+         */
+        bool Offscreen = false;
+
+        /**
+         * @brief The resolution of the framebuffer an offscreen game draws into. This must be set before Run() is called.
+         */
+        Resolution OffscreenResolution = Resolution(1280, 720);
+
+        /**
+         * @brief Determines whether the game runs without a window, OpenGL or audio, only calling Update(), such as for a server's authoritative simulation.
+         * 
+         * Headless games don't use GLFW, so any number of them can run at once on separate threads. They need a fixed timestep set with PreferredUpdates.
+         * This must be set before Run() is called.
+         */
+        bool Headless = false;
+
+        /**
+         * @brief Determines whether a headless game runs its updates back to back as fast as possible rather than in real time.
+         * 
+         * Fast-forward needs a fixed timestep set with PreferredUpdates. If the game's clock is a ManualClock it is advanced by the timestep after every update,
+         * so simulation time is deterministic. Without a clock set with SetClock a ManualClock is used.
+         */
+        bool FastForward = false;
+
+        /**
+         * @brief Sets the clock used to time updates and draws instead of the default, which must outlive the game loop. This must be called before Run().
+         */
+        inline void SetClock(Clock* c) noexcept
+        {
+            clock = c;
+        }
+
+        /**
+         * @brief Returns the clock timing the game loop, or nullptr if the game isn't running and no clock has been set.
+         */
+        inline Clock* GetClock() const noexcept
+        {
+            return clock;
+        }
+
+        /**
+         * @brief Sets the job system used instead of creating one, which must outlive the game loop and isn't disposed by the game. This must be called before Run().
+         *
+         * Headless games running at once can share one job system rather than each starting a worker for every core.
+         * Main thread jobs are only run by a game running on the thread that constructed the job system.
+         */
+        inline void SetJobSystem(JobSystem* js) noexcept
+        {
+            jobSystem = js;
+        }
+
+        /**
+         * @brief Registers a snapshot to be flipped between Update() and Draw() every frame. The snapshot must outlive the game loop.
+         */
+        inline void AddRenderSnapshot(RenderSnapshotBase* snapshot)
+        {
+            snapshots.push_back(snapshot);
+        }
     public:
         /**
          * @brief Code to execute before the game starts running.
@@ -125,6 +226,7 @@ namespace FaceEngine
          * @brief Runs the game on the current thread.
          * 
          * An exception will be thrown if an error occurs while setting up the graphics environment.
+         * Only one windowed game can run at a time, but headless games can run alongside it and each other.
          */
         void Run();
 
@@ -2,8 +2,10 @@
 #define FACEENGINE_GAME_GAMEDRAW_H_
 
 #include <cstdint>
+#include <string>
 
 #include "FaceEngine/Resource.h"
+#include "FaceEngine/GPUProfiler.h"
 
 namespace FaceEngine
 {
@@ -27,6 +29,18 @@ namespace FaceEngine
         inline double GetAlpha() const noexcept { return alpha; }
 
         inline double GetFPS() const noexcept { return fps; }
+
+        /**
+         * @brief Returns the rolling average GPU time per frame of a render pass, such as "SpriteBatcher::End", in milliseconds.
+         * 
+         * GPU times are only measured while GPUProfiler is enabled.
+         */
+        inline double GetGPUTime(const std::string& pass) const { return GPUProfiler::GetAverage(pass); }
+
+        /**
+         * @brief Returns the rolling average GPU time per frame of every timed render pass in milliseconds.
+         */
+        inline double GetGPUFrameTime() const noexcept { return GPUProfiler::GetFrameAverage(); }
     };
 }
 
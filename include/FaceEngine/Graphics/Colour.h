@@ -1,6 +1,7 @@
 #ifndef FACEENGINE_GRAPHICS_COLOUR_H
 #define FACEENGINE_GRAPHICS_COLOUR_H
 
+#include <algorithm>
 #include <string>
 #include <iostream>
 
@@ -20,51 +21,50 @@ namespace FaceEngine
     public:
         // ----- Constuctors and Destructors -----
 
-        Colour();
-        Colour(float r, float g, float b);
-        Colour(float r, float g, float b, float a);
-        ~Colour();
+        constexpr Colour();
+        constexpr Colour(float r, float g, float b);
+        constexpr Colour(float r, float g, float b, float a);
 
         // ----- Factory Methods -----
 
-        static Colour CreateFromRGB(int r, int g, int b);
+        static constexpr Colour CreateFromRGB(int r, int g, int b);
         static Colour CreateFromHSL(int h, float s, float l);
         static Colour CreateFromHSV(int h, float s, float v);
 
         // ----- Getters -----
 
-        float GetR() const;
-        float GetG() const;
-        float GetB() const;
-        float GetA() const;
+        constexpr float GetR() const;
+        constexpr float GetG() const;
+        constexpr float GetB() const;
+        constexpr float GetA() const;
 
-        int GetRAsInt() const;
-        int GetGAsInt() const;
-        int GetBAsInt() const;
-        int GetAAsInt() const;
+        constexpr int GetRAsInt() const;
+        constexpr int GetGAsInt() const;
+        constexpr int GetBAsInt() const;
+        constexpr int GetAAsInt() const;
 
         int GetHue() const;
-        float GetHSVSaturation() const;
-        float GetHSVValue() const;
+        constexpr float GetHSVSaturation() const;
+        constexpr float GetHSVValue() const;
         float GetHSLSaturation() const;
-        float GetHSLLuminance() const;
+        constexpr float GetHSLLuminance() const;
 
         std::string GetHex(bool includeHead = true) const;
 
         // ----- Setters -----
 
-        void SetR(float r);
-        void SetG(float g);
-        void SetB(float b);
-        void SetA(float a);
+        constexpr void SetR(float r);
+        constexpr void SetG(float g);
+        constexpr void SetB(float b);
+        constexpr void SetA(float a);
 
-        void SetRAsInt(int r);
-        void SetGAsInt(int g);
-        void SetBAsInt(int b);
-        void SetAAsInt(int a);
+        constexpr void SetRAsInt(int r);
+        constexpr void SetGAsInt(int g);
+        constexpr void SetBAsInt(int b);
+        constexpr void SetAAsInt(int a);
 
-        void SetRGB(float r, float g, float b, float a);
-        void SetRGB(int r, int g, int b, int a);
+        constexpr void SetRGB(float r, float g, float b, float a);
+        constexpr void SetRGB(int r, int g, int b, int a);
         void SetHSV(int hue, float saturation, float value, float opacity);
         void SetHSL(int hue, float saturation, float lightness, float opacity);
         void SetHex(std::string hex);
@@ -102,7 +102,7 @@ namespace FaceEngine
         static Colour Add(Colour& firstColour, Colour& secondColour);
         static Colour Subtract(Colour& firstColour, Colour& secondColour);
         static bool Equals(Colour& firstColour, Colour& secondColour);
-        static Colour Lerp(const Colour& startColour, const Colour& endColour, float t);
+        static constexpr Colour Lerp(const Colour& startColour, const Colour& endColour, float t);
 
         // ----- Colour Presets -----
 
@@ -118,6 +118,165 @@ namespace FaceEngine
         static const Colour Blue;
         static const Colour Magenta;
     };
+
+    constexpr Colour::Colour() : R(1), G(1), B(1), A(1)
+    {
+    }
+
+    constexpr Colour::Colour(float r, float g, float b) : R(r), G(g), B(b), A(1)
+    {
+    }
+
+    constexpr Colour::Colour(float r, float g, float b, float a) : R(r), G(g), B(b), A(a)
+    {
+    }
+
+    constexpr Colour Colour::CreateFromRGB(int r, int g, int b)
+    {
+        return Colour(r / 255.0, g / 255.0, b / 255.0);
+    }
+
+    constexpr float Colour::GetR() const
+    {
+        return R;
+    }
+
+    constexpr float Colour::GetG() const
+    {
+        return G;
+    }
+
+    constexpr float Colour::GetB() const
+    {
+        return B;
+    }
+
+    constexpr float Colour::GetA() const
+    {
+        return A;
+    }
+
+    constexpr int Colour::GetRAsInt() const
+    {
+        return (int)((R * 255) + 0.5);
+    }
+
+    constexpr int Colour::GetGAsInt() const
+    {
+        return (int)((G * 255) + 0.5);
+    }
+
+    constexpr int Colour::GetBAsInt() const
+    {
+        return (int)((B * 255) + 0.5);
+    }
+
+    constexpr int Colour::GetAAsInt() const
+    {
+        return (int)((A * 255) + 0.5);
+    }
+
+    constexpr float Colour::GetHSVSaturation() const
+    {
+        float max = std::max(std::max(R, G), B);
+        float delta = max - std::min(std::min(R, G), B);
+
+        if (delta == 0)
+        {
+            return 0;
+        }
+
+        return delta / max;
+    }
+
+    constexpr float Colour::GetHSVValue() const
+    {
+        return std::max(std::max(R, G), B);
+    }
+
+    constexpr float Colour::GetHSLLuminance() const
+    {
+        float max = std::max(std::max(R, G), B);
+        float min = std::min(std::min(R, G), B);
+
+        return (max + min) / 2;
+    }
+
+    constexpr void Colour::SetR(float r)
+    {
+        R = r;
+    }
+
+    constexpr void Colour::SetG(float g)
+    {
+        G = g;
+    }
+
+    constexpr void Colour::SetB(float b)
+    {
+        B = b;
+    }
+
+    constexpr void Colour::SetA(float a)
+    {
+        A = a;
+    }
+
+    constexpr void Colour::SetRAsInt(int r)
+    {
+        R = r / 255.0;
+    }
+
+    constexpr void Colour::SetGAsInt(int g)
+    {
+        G = g / 255.0;
+    }
+
+    constexpr void Colour::SetBAsInt(int b)
+    {
+        B = b / 255.0;
+    }
+
+    constexpr void Colour::SetAAsInt(int a)
+    {
+        A = a / 255.0;
+    }
+
+    constexpr void Colour::SetRGB(float r, float g, float b, float a)
+    {
+        R = r;
+        G = g;
+        B = b;
+        A = a;
+    }
+
+    constexpr void Colour::SetRGB(int r, int g, int b, int a)
+    {
+        R = r / 255.0;
+        G = g / 255.0;
+        B = b / 255.0;
+        A = a / 255.0;
+    }
+
+    constexpr Colour Colour::Lerp(const Colour& startColour, const Colour& endColour, float t)
+    {
+        return Colour(startColour.R + (endColour.R - startColour.R) * t,
+                    startColour.G + (endColour.G - startColour.G) * t,
+                    startColour.B + (endColour.B - startColour.B) * t,
+                    startColour.A + (endColour.A - startColour.A) * t);
+    }
+
+    constexpr Colour Colour::Black = Colour(0, 0, 0);
+    constexpr Colour Colour::White = Colour(1, 1, 1);
+    constexpr Colour Colour::Red = Colour(1, 0, 0);
+    constexpr Colour Colour::Orange = Colour(1, 0.5, 0);
+    constexpr Colour Colour::Yellow = Colour(1, 1, 0);
+    constexpr Colour Colour::Lime = Colour(0.5, 1, 0);
+    constexpr Colour Colour::Green = Colour(0, 1, 0);
+    constexpr Colour Colour::Cyan = Colour(0, 1, 1);
+    constexpr Colour Colour::LightBlue = Colour(0, 0.5, 1);
+    constexpr Colour Colour::Blue = Colour(0, 0, 1);
+    constexpr Colour Colour::Magenta = Colour(1, 0, 1);
 }
 
 std::ostream& operator<<(std::ostream& os, const FaceEngine::Colour& c) noexcept;
@@ -125,7 +284,20 @@ std::ostream& operator<<(std::ostream& os, const FaceEngine::Colour& c) noexcept
 FaceEngine::Colour operator +(FaceEngine::Colour& firstColour, FaceEngine::Colour& secondColour);
 FaceEngine::Colour operator -(FaceEngine::Colour& firstColour, FaceEngine::Colour& secondColour);
 
-bool operator ==(const FaceEngine::Colour& firstColour, const FaceEngine::Colour& secondColour) noexcept;
-bool operator !=(const FaceEngine::Colour& firstColour, const FaceEngine::Colour& secondColour) noexcept;
+constexpr bool operator ==(const FaceEngine::Colour& firstColour, const FaceEngine::Colour& secondColour) noexcept
+{
+    return firstColour.GetR() == secondColour.GetR() &&
+           firstColour.GetG() == secondColour.GetG() &&
+           firstColour.GetB() == secondColour.GetB() &&
+           firstColour.GetA() == secondColour.GetA();
+}
+
+constexpr bool operator !=(const FaceEngine::Colour& firstColour, const FaceEngine::Colour& secondColour) noexcept
+{
+    return firstColour.GetR() != secondColour.GetR() ||
+           firstColour.GetG() != secondColour.GetG() ||
+           firstColour.GetB() != secondColour.GetB() ||
+           firstColour.GetA() != secondColour.GetA();
+}
 
 #endif
\ No newline at end of file
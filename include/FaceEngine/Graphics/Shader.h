@@ -7,6 +7,7 @@
 #include "FaceEngine/Resource.h"
 #include "FaceEngine/Exception.h"
 #include "FaceEngine/ResourceManager.h"
+#include "FaceEngine/ResourcePool.h"
 #include "FaceEngine/Math/Vector2.h"
 #include "FaceEngine/Math/Matrix4f.h"
 
@@ -22,6 +23,16 @@ namespace FaceEngine
             program = p;
         }
     public:
+        static inline void* operator new(std::size_t size)
+        {
+            return ResourcePool<Shader>::Allocate(size);
+        }
+
+        static inline void operator delete(void* p, std::size_t size) noexcept
+        {
+            ResourcePool<Shader>::Free(p, size);
+        }
+
         inline bool IsDisposed() noexcept override
         {
             return program == 0;
@@ -29,6 +40,11 @@ namespace FaceEngine
 
         void Dispose() noexcept override;
 
+        inline std::size_t GetCPUMemorySize() const noexcept override
+        {
+            return sizeof(Shader);
+        }
+
         inline void SetActive() const noexcept
         {
             if (program != 0)
@@ -37,6 +53,7 @@ namespace FaceEngine
             }
         }
 
+        void SetUniform(const std::string&, float);
         void SetUniform(const std::string&, const Vector2f&);
         void SetUniform(const std::string&, const Matrix4f&);
 
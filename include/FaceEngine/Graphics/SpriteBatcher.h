@@ -1,12 +1,14 @@
 #ifndef FACEENGINE_GRAPHICS_SPRITEBATCHER_H_
 #define FACEENGINE_GRAPHICS_SPRITEBATCHER_H_
 
+#include <cstdint>
 #include <vector>
 
 #include "FaceEngine/Exception.h"
 #include "FaceEngine/Window.h"
 #include "FaceEngine/Resource.h"
 #include "FaceEngine/ResourceManager.h"
+#include "FaceEngine/ResourcePool.h"
 #include "FaceEngine/Math/Rectangle.h"
 #include "FaceEngine/Graphics/Colour.h"
 #include "FaceEngine/Graphics/Shader.h"
@@ -14,9 +16,26 @@
 #include "FaceEngine/Graphics/TextureFont.h"
 
 #define MAX_JOBS 4194304UL
+#define MAX_BATCH_SPRITES 4096UL
 
 namespace FaceEngine
 {
+    /**
+     * @brief How the sprites of a batch are blended with what has already been drawn.
+     *
+     * Every blend state draws textures with straight or premultiplied alpha correctly, as told by Texture2D::IsPremultiplied, so text can be drawn in any batch.
+     * BlendAlpha and BlendPremultiplied both draw sprites over what is behind them. BlendOpaque disables blending entirely, which is the cheapest option
+     * for sprites without transparency; their colours are written as they are.
+     */
+    enum BlendState
+    {
+        BlendAlpha,
+        BlendPremultiplied,
+        BlendAdditive,
+        BlendMultiply,
+        BlendOpaque
+    };
+
     // For internal use only.
     struct __BatchJob
     {
@@ -28,6 +47,17 @@ namespace FaceEngine
         Colour _Colour;
     };
 
+    /**
+     * @brief Counts of the work a SpriteBatcher has submitted since its statistics were last reset.
+     */
+    struct SpriteBatcherStatistics
+    {
+        std::uint64_t Sprites = 0;
+        std::uint64_t DrawCalls = 0;
+        std::uint64_t Uploads = 0;
+        std::uint64_t BytesUploaded = 0;
+    };
+
     class SpriteBatcher : public Resource
     {
     private:
@@ -38,35 +68,71 @@ namespace FaceEngine
         GLuint vao, vbo, ebo;
 
         std::vector<__BatchJob> jobs;
+        std::vector<float> vertexData;
         Matrix4f transform;
+        BlendState blendState;
         bool hasBegun;
+        // whether the shader's premultiplyTexture uniform is set, which is false once it's linked
+        bool shaderPremultiplies;
+        SpriteBatcherStatistics statistics;
+
+        SpriteBatcher(Window*, ResourceManager*, Shader*);
 
-        SpriteBatcher(Window*, ResourceManager*, Shader*) noexcept;
+        static void WriteVertices(float*, const __BatchJob&, bool) noexcept;
     public:
+        static inline void* operator new(std::size_t size)
+        {
+            return ResourcePool<SpriteBatcher>::Allocate(size);
+        }
+
+        static inline void operator delete(void* p, std::size_t size) noexcept
+        {
+            ResourcePool<SpriteBatcher>::Free(p, size);
+        }
+
         inline bool IsDisposed() noexcept override { return disposed; }
-        inline void Dispose() noexcept override { resMan->DisposeResource(shader); disposed = true; }
+        void Dispose() noexcept override;
+
+        inline std::size_t GetGPUMemorySize() const noexcept override
+        {
+            // vertex and index buffers for a full batch
+            return disposed ? 0 : MAX_BATCH_SPRITES * (240 + sizeof(GLuint) * 6);
+        }
+
+        inline std::size_t GetCPUMemorySize() const noexcept override
+        {
+            return sizeof(SpriteBatcher) + jobs.capacity() * sizeof(__BatchJob) + vertexData.capacity() * sizeof(float);
+        }
     
         /**
          * @brief Begins a sprite batch with an identity transform.
          */
-        void Begin();
+        void Begin(BlendState = BlendAlpha);
 
         /**
          * @brief Begins a sprite batch with the specified translation.
          */
-        void Begin(const Vector2f&);
+        void Begin(const Vector2f&, BlendState = BlendAlpha);
 
         /**
          * @brief Begins a sprite batch with the specified transform.
-         * 
          */
-        void Begin(const Matrix4f&);
+        void Begin(const Matrix4f&, BlendState = BlendAlpha);
 
         /**
          * @brief Ends a sprite batch. All sprite jobs will be drawn and removed from the batch.
+         * 
+         * Consecutive jobs using the same texture (or regions of the same TextureAtlas page) are drawn with a single draw call.
          */
         void End();
 
+        /**
+         * @brief Returns the sprites, draw calls and vertex uploads submitted by End() since the statistics were last reset.
+         */
+        inline const SpriteBatcherStatistics& GetStatistics() const noexcept { return statistics; }
+
+        inline void ResetStatistics() noexcept { statistics = SpriteBatcherStatistics(); }
+
         void Draw(Texture2D*);
         void Draw(Texture2D*, const Colour&);
         void Draw(Texture2D*, float, const Colour&);
@@ -2,37 +2,128 @@
 #define FACEENGINE_GRAPHICS_TEXTURE2D_H_
 
 #include <cstdint>
+#include <cstddef>
+#include <functional>
+#include <memory>
 
 #include "FaceEngine/OGL.h"
 #include "FaceEngine/Resource.h"
 #include "FaceEngine/ResourceManager.h"
+#include "FaceEngine/ResourcePool.h"
 #include "FaceEngine/Exception.h"
 
 namespace FaceEngine
 {
+    enum TextureFilter
+    {
+        TextureFilterNearest,
+        TextureFilterLinear
+    };
+
+    enum TextureWrap
+    {
+        TextureWrapRepeat,
+        TextureWrapClampToEdge,
+        TextureWrapMirroredRepeat
+    };
+
+    /**
+     * @brief Sampling options for a Texture2D.
+     *
+     * When Mipmaps is set, mip levels supplied with the image data (such as those generated offline by the content builder) are uploaded,
+     * otherwise the mip chain is generated when the texture is created.
+     */
+    struct TextureOptions
+    {
+        TextureFilter MinFilter = TextureFilterNearest;
+        TextureFilter MagFilter = TextureFilterNearest;
+        TextureWrap Wrap = TextureWrapRepeat;
+        bool Mipmaps = false;
+    };
+
     class Texture2D : public Resource
     {
+        friend class ContentLoader;
+        friend class GPUMemoryTracker;
+        friend class TextureAtlas;
     private:
+        ResourceManager* resMan;
         GLuint handle;
         std::uint32_t width, height;
+        TextureOptions options;
+        std::uint32_t mipLevels;
+        std::uint32_t dataLevels;
+        bool premultiplied;
+        Texture2D* page;
+        std::uint32_t sourceX, sourceY;
+        bool disposed;
+        bool evictable;
+        std::uint64_t lastUsed;
+        // neighbours in the GPUMemoryTracker's least recently used list while the texture is resident and evictable
+        Texture2D* previousUsed;
+        Texture2D* nextUsed;
+        std::function<std::unique_ptr<std::uint8_t[]>()> reloader;
     
-        inline Texture2D(GLuint t, const std::uint32_t w, const std::uint32_t h) noexcept
+        inline Texture2D(ResourceManager* rm, const std::uint32_t w, const std::uint32_t h, const TextureOptions& o) noexcept
         {
-            handle = t;
+            resMan = rm;
+            handle = 0;
             width = w;
             height = h;
+            options = o;
+            mipLevels = 1;
+            dataLevels = 1;
+            premultiplied = false;
+            page = nullptr;
+            sourceX = 0;
+            sourceY = 0;
+            disposed = false;
+            evictable = false;
+            lastUsed = 0;
+            previousUsed = nullptr;
+            nextUsed = nullptr;
         }
+
+        std::uint32_t GetUploadLevels(std::uint32_t) const noexcept;
+        void Upload(const std::uint8_t*, std::uint32_t) noexcept;
+
+        void Evict() noexcept;
     public:
+        static inline void* operator new(std::size_t size)
+        {
+            return ResourcePool<Texture2D>::Allocate(size);
+        }
+
+        static inline void operator delete(void* p, std::size_t size) noexcept
+        {
+            ResourcePool<Texture2D>::Free(p, size);
+        }
+
         inline bool IsDisposed() noexcept override
         {
-            return handle == 0;
+            return disposed;
         }
 
         void Dispose() noexcept override;
 
+        inline std::size_t GetGPUMemorySize() const noexcept override
+        {
+            return handle != 0 ? GetMipChainSize(width, height, mipLevels) : 0;
+        }
+
+        inline std::size_t GetCPUMemorySize() const noexcept override
+        {
+            return sizeof(Texture2D);
+        }
+
+        /**
+         * @brief Returns the OpenGL handle of the texture, which is 0 while the texture is evicted.
+         * 
+         * Regions of a TextureAtlas return the handle of the atlas page they were packed into.
+         */
         inline const GLuint GetHandle() const noexcept
         {
-            return handle;
+            return page ? page->handle : handle;
         }
 
         inline const std::uint32_t GetWidth() const noexcept
@@ -45,7 +136,89 @@ namespace FaceEngine
             return height;
         }
 
+        inline const TextureOptions& GetOptions() const noexcept
+        {
+            return options;
+        }
+
+        /**
+         * @brief Returns true if the colour channels of the texture are premultiplied by alpha. SpriteBatcher draws either kind correctly with every blend state.
+         */
+        inline bool IsPremultiplied() const noexcept
+        {
+            return premultiplied;
+        }
+
+        /**
+         * @brief Returns the number of mip levels in video memory, including the base level.
+         */
+        inline std::uint32_t GetMipLevels() const noexcept
+        {
+            return mipLevels;
+        }
+
+        /**
+         * @brief Returns the offset of the texture within its atlas page (top-down, as used by source rectangles), or zero if it isn't an atlas region.
+         */
+        inline std::uint32_t GetSourceX() const noexcept
+        {
+            return sourceX;
+        }
+
+        inline std::uint32_t GetSourceY() const noexcept
+        {
+            return sourceY;
+        }
+
+        /**
+         * @brief Returns the atlas page the texture was packed into, or nullptr if it isn't an atlas region.
+         */
+        inline Texture2D* GetPage() const noexcept
+        {
+            return page;
+        }
+
+        /**
+         * @brief Returns true if the texture is in video memory, false if it has been evicted or disposed.
+         */
+        inline bool IsResident() const noexcept
+        {
+            return GetHandle() != 0;
+        }
+
+        inline bool IsEvictable() const noexcept
+        {
+            return evictable;
+        }
+
+        /**
+         * @brief Sets whether the texture can be evicted from video memory. Only textures loaded from content files can be evicted.
+         */
+        void SetEvictable(bool);
+
+        /**
+         * @brief Marks the texture as drawn in the current frame and returns its handle, reloading it from its content file if it was evicted.
+         */
+        GLuint Use();
+
         static Texture2D* CreateTexture2D(ResourceManager*, const std::uint32_t, const std::uint32_t, std::uint8_t*);
+
+        /**
+         * @brief Creates a texture with the given sampling options.
+         * 
+         * The image data holds the given number of mip levels back to back, starting with the base level, each level half the size of the previous one.
+         */
+        static Texture2D* CreateTexture2D(ResourceManager*, const std::uint32_t, const std::uint32_t, std::uint8_t*, const TextureOptions&, std::uint32_t = 1);
+
+        /**
+         * @brief Returns the number of levels in a full mip chain for a texture of the given size.
+         */
+        static std::uint32_t GetMaxMipLevels(const std::uint32_t, const std::uint32_t) noexcept;
+
+        /**
+         * @brief Returns the size in bytes of the given number of RGBA mip levels, starting with the base level.
+         */
+        static std::size_t GetMipChainSize(const std::uint32_t, const std::uint32_t, std::uint32_t) noexcept;
     };
 }
 
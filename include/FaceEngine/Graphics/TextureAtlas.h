@@ -0,0 +1,110 @@
+#ifndef FACEENGINE_GRAPHICS_TEXTUREATLAS_H_
+#define FACEENGINE_GRAPHICS_TEXTUREATLAS_H_
+
+#include <cstdint>
+#include <vector>
+
+#include "FaceEngine/Resource.h"
+#include "FaceEngine/ResourceManager.h"
+#include "FaceEngine/ResourcePool.h"
+#include "FaceEngine/Graphics/Texture2D.h"
+
+namespace FaceEngine
+{
+    /**
+     * @brief Packs images into large texture pages at runtime so sprites drawn from the same page can be batched together.
+     *
+     * Images are placed with a skyline packer and uploaded with glTexSubImage2D. When a page is full a new page is created.
+     * Each added image is returned as a Texture2D referencing a region of a page, which can be drawn like any other texture.
+     * Regions are owned by the atlas and are disposed along with it, unless they have already been disposed through the ResourceManager.
+     */
+    class TextureAtlas : public Resource
+    {
+    private:
+        struct SkylineNode
+        {
+            std::uint32_t X;
+            std::uint32_t Y;
+            std::uint32_t Width;
+        };
+
+        struct Page
+        {
+            Texture2D* Texture;
+            ResourceHandle Handle;
+            std::vector<SkylineNode> Skyline;
+        };
+
+        ResourceManager* resMan;
+        std::uint32_t pageWidth, pageHeight;
+        std::uint32_t padding;
+        bool premultiplied;
+        std::vector<Page> pages;
+        // handed out as ordinary textures that may be disposed before the atlas, so they're disposed by handle
+        std::vector<ResourceHandle> regions;
+        bool disposed;
+
+        inline TextureAtlas(ResourceManager* rm, std::uint32_t w, std::uint32_t h, std::uint32_t p, bool pm) noexcept
+        {
+            resMan = rm;
+            pageWidth = w;
+            pageHeight = h;
+            padding = p;
+            premultiplied = pm;
+            disposed = false;
+        }
+
+        bool Fit(const Page&, std::uint32_t, std::uint32_t, std::size_t&, std::uint32_t&, std::uint32_t&) const noexcept;
+        void AddSkylineLevel(Page&, std::size_t, std::uint32_t, std::uint32_t, std::uint32_t, std::uint32_t);
+        void AddPage();
+        void DisposeTracked(ResourceHandle) noexcept;
+    public:
+        static inline void* operator new(std::size_t size)
+        {
+            return ResourcePool<TextureAtlas>::Allocate(size);
+        }
+
+        static inline void operator delete(void* p, std::size_t size) noexcept
+        {
+            ResourcePool<TextureAtlas>::Free(p, size);
+        }
+
+        inline bool IsDisposed() noexcept override
+        {
+            return disposed;
+        }
+
+        void Dispose() noexcept override;
+
+        std::size_t GetCPUMemorySize() const noexcept override;
+
+        inline std::uint32_t GetPageWidth() const noexcept { return pageWidth; }
+
+        inline std::uint32_t GetPageHeight() const noexcept { return pageHeight; }
+
+        inline std::size_t GetPageCount() const noexcept { return pages.size(); }
+
+        /**
+         * @brief Returns true if the images added to the atlas have colour channels premultiplied by alpha, as do its pages and regions.
+         */
+        inline bool IsPremultiplied() const noexcept { return premultiplied; }
+
+        inline Texture2D* GetPage(std::size_t i) const noexcept { return pages[i].Texture; }
+
+        /**
+         * @brief Packs RGBA image data (bottom row first, as stored in content files) into the atlas.
+         * 
+         * The data must be premultiplied by alpha if the atlas is, as every image on a page is drawn the same way.
+         * 
+         * @return Texture2D* A texture referencing the region of the page the image was packed into.
+         */
+        Texture2D* Add(std::uint32_t, std::uint32_t, const std::uint8_t*);
+
+        /**
+         * @brief Creates a texture atlas with the given page size and padding between packed images, and whether the images added are premultiplied by alpha.
+         */
+        static TextureAtlas* CreateTextureAtlas(ResourceManager*, std::uint32_t = 2048, std::uint32_t = 2048, std::uint32_t = 1, bool = false);
+    };
+}
+
+#endif
\ No newline at end of file
@@ -6,7 +6,9 @@
 
 #include "FaceEngine/Resource.h"
 #include "FaceEngine/ResourceManager.h"
+#include "FaceEngine/ResourcePool.h"
 #include "FaceEngine/Graphics/Texture2D.h"
+#include "FaceEngine/Graphics/TextureAtlas.h"
 #include "FaceEngine/Math/Vector2.h"
 
 namespace FaceEngine
@@ -51,8 +53,19 @@ namespace FaceEngine
         std::int32_t descender;
         std::int32_t lineSpacing;
         std::vector<FontChar> fontChars;
+        TextureAtlas* atlas;
     public:
-        inline TextureFont(ResourceManager* r, std::uint32_t s, std::int32_t a, std::int32_t d, std::int32_t l, const std::vector<FontChar>& c)
+        static inline void* operator new(std::size_t size)
+        {
+            return ResourcePool<TextureFont>::Allocate(size);
+        }
+
+        static inline void operator delete(void* p, std::size_t size) noexcept
+        {
+            ResourcePool<TextureFont>::Free(p, size);
+        }
+
+        inline TextureFont(ResourceManager* r, std::uint32_t s, std::int32_t a, std::int32_t d, std::int32_t l, const std::vector<FontChar>& c, TextureAtlas* t = nullptr)
         {
             resMan = r;
             size = s;
@@ -60,6 +73,7 @@ namespace FaceEngine
             descender = d;
             lineSpacing = l;
             fontChars = c;
+            atlas = t;
         }
 
         inline bool IsDisposed() noexcept override
@@ -69,6 +83,11 @@ namespace FaceEngine
 
         void Dispose() noexcept override;
 
+        inline std::size_t GetCPUMemorySize() const noexcept override
+        {
+            return sizeof(TextureFont) + fontChars.capacity() * sizeof(FontChar);
+        }
+
         inline std::uint32_t GetSize() const noexcept { return size; }
 
         inline std::int32_t GetAscender() const noexcept { return ascender; }
@@ -79,11 +98,19 @@ namespace FaceEngine
 
         inline const std::vector<FontChar>& GetFontChars() const noexcept { return fontChars; }
 
+        /**
+         * @brief Returns the atlas the glyph textures were packed into, or nullptr if each glyph has its own texture.
+         */
+        inline TextureAtlas* GetAtlas() const noexcept { return atlas; }
+
         const FontChar* GetFontChar(std::uint32_t) const;
 
         Vector2f MeasureString(const std::string&) const;
 
-        static TextureFont* CreateTextureFont(ResourceManager*, std::uint32_t, std::int32_t, std::int32_t, std::int32_t, const std::vector<FontChar>&);
+        /**
+         * @brief Creates a TextureFont. If an atlas is given the glyph textures must be regions of it, and the atlas is disposed with the font.
+         */
+        static TextureFont* CreateTextureFont(ResourceManager*, std::uint32_t, std::int32_t, std::int32_t, std::int32_t, const std::vector<FontChar>&, TextureAtlas* = nullptr);
     };
 }
 
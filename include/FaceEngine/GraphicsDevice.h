@@ -15,6 +15,9 @@ namespace FaceEngine
     private:
         GraphicsDevice();
 
+        // an offscreen device has a single virtual display with the resolution of the offscreen window
+        GraphicsDevice(const Resolution&);
+
         std::vector<Display> displays;
     public:
         inline const std::vector<Display>& GetDisplays() const noexcept
@@ -0,0 +1,14 @@
+#ifndef FACEENGINE_JSON_H_
+#define FACEENGINE_JSON_H_
+
+#include <string>
+
+namespace FaceEngine
+{
+    /**
+     * @brief Escapes a string for use inside a JSON string, writing control characters as \u00XX escapes.
+     */
+    std::string EscapeJSON(const std::string&);
+}
+
+#endif
\ No newline at end of file
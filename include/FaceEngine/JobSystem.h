@@ -0,0 +1,179 @@
+#ifndef FACEENGINE_JOBSYSTEM_H_
+#define FACEENGINE_JOBSYSTEM_H_
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "FaceEngine/Resource.h"
+
+namespace FaceEngine
+{
+    class JobSystem;
+
+    // For internal use only.
+    struct __JobState
+    {
+        std::function<void()> Function;
+        bool MainThread = false;
+        // unfinished dependencies, plus one while the job is being scheduled
+        std::atomic_uint32_t Dependencies { 1 };
+        std::atomic_bool Done { false };
+        std::exception_ptr Error;
+        std::mutex Mutex;
+        std::vector<std::shared_ptr<__JobState>> Continuations;
+    };
+
+    /**
+     * @brief A handle to a job scheduled with a JobSystem, used to wait for it or schedule jobs that depend on it.
+     */
+    class JobHandle
+    {
+        friend class JobSystem;
+    private:
+        std::shared_ptr<__JobState> state;
+
+        inline JobHandle(std::shared_ptr<__JobState> s) noexcept : state(std::move(s)) { }
+    public:
+        inline JobHandle() noexcept { }
+
+        /**
+         * @brief Returns a boolean value indicating whether the job has finished running. An empty handle is always complete.
+         */
+        inline bool IsComplete() const noexcept
+        {
+            return state == nullptr || state->Done.load(std::memory_order_acquire);
+        }
+    };
+
+    /**
+     * @brief A work-stealing job scheduler with a worker thread for every core but one, which is left for the main thread.
+     *
+     * Each worker has its own queue: jobs scheduled from a worker are pushed to its queue and run newest first, while idle workers steal the oldest jobs from other queues.
+     * Jobs scheduled from other threads go to a shared queue. Threads that wait for jobs run other jobs while they wait, so jobs may wait for other jobs.
+     * Jobs that must run on the main thread, such as jobs making OpenGL calls, are queued separately and run by Game once per frame.
+     * Game creates a JobSystem for the engine and the game to share, unless one is given to it with Game::SetJobSystem.
+     *
+     * A JobSystem may have no workers, in which case jobs run on the threads waiting for them and in RunMainThreadJobs().
+     */
+    class JobSystem : public Resource
+    {
+    private:
+        struct Worker
+        {
+            std::mutex Mutex;
+            std::deque<std::shared_ptr<__JobState>> Jobs;
+        };
+
+        std::vector<std::unique_ptr<Worker>> workers;
+        std::vector<std::thread> threads;
+        std::mutex sharedMutex;
+        std::deque<std::shared_ptr<__JobState>> sharedJobs;
+        std::mutex mainMutex;
+        std::deque<std::shared_ptr<__JobState>> mainJobs;
+        std::thread::id mainThread;
+
+        std::mutex sleepMutex;
+        std::condition_variable wake;
+        std::atomic_size_t queued;
+        std::atomic_bool stopping;
+        bool disposed;
+
+        void WorkerLoop(std::size_t);
+        void Enqueue(const std::shared_ptr<__JobState>&);
+        std::shared_ptr<__JobState> Dequeue(std::size_t) noexcept;
+        bool RunMainThreadJob();
+        void Execute(const std::shared_ptr<__JobState>&);
+        JobHandle Schedule(std::function<void()>, const std::vector<JobHandle>&, bool);
+    public:
+        /**
+         * @brief The worker count that uses one less than the number of cores.
+         */
+        static constexpr std::size_t DefaultWorkerCount = (std::size_t)-1;
+
+        /**
+         * @brief Constructs a JobSystem with the given number of worker threads.
+         *
+         * The thread constructing the JobSystem is treated as the main thread.
+         */
+        JobSystem(std::size_t = DefaultWorkerCount);
+
+        inline ~JobSystem()
+        {
+            Dispose();
+        }
+
+        inline bool IsDisposed() noexcept override { return disposed; }
+
+        /**
+         * @brief Finishes every queued job and stops the worker threads.
+         */
+        void Dispose() noexcept override;
+
+        inline std::size_t GetWorkerCount() const noexcept
+        {
+            return threads.size();
+        }
+
+        /**
+         * @brief Schedules a job to run on a worker thread.
+         */
+        JobHandle Schedule(std::function<void()>);
+
+        /**
+         * @brief Schedules a job to run on a worker thread once all of its dependencies have finished.
+         */
+        JobHandle Schedule(std::function<void()>, const std::vector<JobHandle>&);
+
+        /**
+         * @brief Schedules a continuation, a job that runs once the given job has finished.
+         */
+        inline JobHandle Then(const JobHandle& job, std::function<void()> function)
+        {
+            return Schedule(std::move(function), std::vector<JobHandle> { job });
+        }
+
+        /**
+         * @brief Schedules a job to run on the main thread, once all of its dependencies have finished. Use this for OpenGL calls and resource creation.
+         */
+        JobHandle ScheduleMainThread(std::function<void()>, const std::vector<JobHandle>& = std::vector<JobHandle>());
+
+        /**
+         * @brief Returns a boolean value indicating whether the calling thread is the one that constructed the JobSystem.
+         */
+        inline bool IsMainThread() const noexcept
+        {
+            return std::this_thread::get_id() == mainThread;
+        }
+
+        /**
+         * @brief Runs the main thread jobs that are ready. Called by Game every frame.
+         *
+         * Without workers, the jobs queued for worker threads are run here too. An exception will be thrown if this is called from another thread.
+         */
+        void RunMainThreadJobs();
+
+        /**
+         * @brief Waits for a job to finish, running other jobs in the meantime, and rethrows any exception the job threw.
+         */
+        void Wait(const JobHandle&);
+
+        /**
+         * @brief Calls the function for every chunk of the range [begin, end) in parallel and waits for all of them.
+         *
+         * The function receives the start and end of its chunk. Chunks are at most grainSize long; a grain size of zero picks one that gives every thread a few chunks.
+         * The calling thread processes chunks too. The first exception thrown by the function is rethrown once every chunk has finished.
+         */
+        void ParallelFor(std::size_t, std::size_t, std::size_t, const std::function<void(std::size_t, std::size_t)>&);
+    };
+}
+
+#endif
\ No newline at end of file
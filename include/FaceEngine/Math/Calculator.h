@@ -25,13 +25,42 @@ namespace FaceEngine
         static constexpr float Root2 = 1.4142135f;
         static constexpr double Root2Double = 1.414213562373095;
 
-        static float DegreesToRadians(float degrees);
-        static float RadiansToDegrees(float radians);
+        static constexpr float DegreesToRadians(float degrees)
+        {
+            return degrees * Pi / 180.0f;
+        }
+
+        static constexpr float RadiansToDegrees(float radians)
+        {
+            return radians * 180.0f / Pi;
+        }
+
         static float WrapAngle(float angle);
         static float WrapAngle180(float angle);
-        static float Lerp(float a, float b, float t);
-        static FaceEngine::Vector2f Lerp(const FaceEngine::Vector2f& a, const FaceEngine::Vector2f& b, float t);
-        static float Clamp(const float value, const float lower, const float upper);
+
+        static constexpr float Lerp(float a, float b, float t)
+        {
+            return (1.0f - t) * a + t * b;
+        }
+
+        static constexpr FaceEngine::Vector2f Lerp(const FaceEngine::Vector2f& a, const FaceEngine::Vector2f& b, float t)
+        {
+            return b * t + a * (1.0f - t);
+        }
+
+        static constexpr float Clamp(const float value, const float lower, const float upper)
+        {
+            if (value < lower)
+            {
+                return lower;
+            }
+            else if (value > upper)
+            {
+                return upper;
+            }
+
+            return value;
+        }
     };
 }
 
@@ -11,20 +11,34 @@ namespace FaceEngine
         Vector2f Position;
         float Radius;
 
-        Circle(const Vector2f& position, const float radius) noexcept;
-        Circle(const float x, const float y, const float radius) noexcept;
-        ~Circle();
+        constexpr Circle(const Vector2f& position, const float radius) noexcept : Position(position), Radius(radius)
+        {
+        }
+
+        constexpr Circle(const float x, const float y, const float radius) noexcept : Position(x, y), Radius(radius)
+        {
+        }
 
         std::string ToString() const noexcept;
 
-        bool Equals(const Circle& circle) const noexcept;
+        constexpr bool Equals(const Circle& circle) const noexcept
+        {
+            return Position == circle.Position && Radius == circle.Radius;
+        }
 
         bool Contains(const Vector2f& vector) const noexcept;
         bool CompletelyContains(const Vector2f& vector) const noexcept;
     };
 }
 
-bool operator==(const FaceEngine::Circle& firstCircle, const FaceEngine::Circle& secondCircle) noexcept;
-bool operator!=(const FaceEngine::Circle& firstCircle, const FaceEngine::Circle& secondCircle) noexcept;
+constexpr bool operator==(const FaceEngine::Circle& firstCircle, const FaceEngine::Circle& secondCircle) noexcept
+{
+    return firstCircle.Equals(secondCircle);
+}
+
+constexpr bool operator!=(const FaceEngine::Circle& firstCircle, const FaceEngine::Circle& secondCircle) noexcept
+{
+    return !firstCircle.Equals(secondCircle);
+}
 
 #endif
\ No newline at end of file
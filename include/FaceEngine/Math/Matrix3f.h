@@ -1,30 +1,91 @@
 #ifndef FACEENGINE_MATH_MATRIX3F_H_
 #define FACEENGINE_MATH_MATRIX3F_H_
 
-#include "FaceEngine/Math/Matrix.h"
+#include <cstddef>
+
+#include "FaceEngine/Math/Rectangle.h"
 #include "FaceEngine/Math/Vector2.h"
 #include "FaceEngine/Math/Vector3.h"
 
 namespace FaceEngine
 {
-    class Matrix3f : public FaceEngine::Matrix
+    class Matrix3f
     {
     public:
         float M11, M12, M13, M21, M22, M23, M31, M32, M33;
 
-        Matrix3f();
-        Matrix3f(const float& m11, const float& m12, const float& m13, const float& m21, const float& m22, const float& m23, const float& m31, const float& m32, const float& m33);
+        constexpr Matrix3f() noexcept : M11(0), M12(0), M13(0), M21(0), M22(0), M23(0), M31(0), M32(0), M33(0)
+        {
+        }
+
+        constexpr Matrix3f(const float m11, const float m12, const float m13, const float m21, const float m22, const float m23, const float m31, const float m32, const float m33) noexcept
+            : M11(m11), M12(m12), M13(m13), M21(m21), M22(m22), M23(m23), M31(m31), M32(m32), M33(m33)
+        {
+        }
+
+        constexpr float GetDeterminant() const noexcept
+        {
+            return (M11 * ((M22 * M33) - (M23 * M32))) - (M12 * ((M21 * M33) - (M23 * M31))) + (M13 * ((M21 * M32) - (M31 * M22)));
+        }
+
+        constexpr void Transform(Vector2f& vector) const noexcept
+        {
+            float oldX = vector.X;
+
+            vector.X = vector.X * M11 + vector.Y * M12 + M13;
+            vector.Y = oldX * M21 + vector.Y * M22 + M23;
+        }
+
+        constexpr void Transform(Vector3f& vector) const noexcept
+        {
+            float oldX = vector.X;
+            float oldY = vector.Y;
+
+            vector.X = vector.X * M11 + vector.Y * M12 + vector.Z * M13;
+            vector.Y = oldX * M21 + vector.Y * M22 + vector.Z * M23;
+            vector.Z = oldX * M31 + oldY * M32 + vector.Z * M33;
+        }
+
+        /**
+         * @brief Transforms count Vector2f as points, the same as Transform(Vector2f&), several at a time with SIMD where available.
+         * The source and destination may be the same array but must not otherwise overlap.
+         */
+        void Transform(const Vector2f* source, Vector2f* destination, std::size_t count) const noexcept;
 
-        float GetDeterminant();
+        /**
+         * @brief Transforms count Vector3f, the same as Transform(Vector3f&), several at a time with SIMD where available.
+         * The source and destination may be the same array but must not otherwise overlap.
+         */
+        void Transform(const Vector3f* source, Vector3f* destination, std::size_t count) const noexcept;
 
-        void Transform(Vector2<float>& vector) const noexcept;
-        void Transform(Vector3f& vector) const noexcept;
+        /**
+         * @brief Calculates the axis-aligned bounding rectangle of each of count Rectanglef after transforming its corners as points.
+         * The source and destination may be the same array but must not otherwise overlap.
+         */
+        void TransformBounds(const Rectanglef* source, Rectanglef* destination, std::size_t count) const noexcept;
 
-        const std::vector<float> ToArray() const noexcept override;
+        /**
+         * @brief Returns a pointer to the nine contiguous elements in row major order, starting at M11, without copying them.
+         */
+        inline float* Data() noexcept { return &M11; }
+        inline const float* Data() const noexcept { return &M11; }
+
+        const std::vector<float> ToArray() const noexcept;
     };
+
+    static_assert(std::is_standard_layout<Matrix3f>() && std::is_trivially_copyable<Matrix3f>() && sizeof(Matrix3f) == 9 * sizeof(float), "Matrix3f must be a plain array of floats.");
 }
 
-FaceEngine::Vector2f operator *(const FaceEngine::Matrix3f& matrix, const FaceEngine::Vector2f& vector) noexcept;
-FaceEngine::Vector3f operator *(const FaceEngine::Matrix3f& matrix, const FaceEngine::Vector3f& vector) noexcept;
+constexpr FaceEngine::Vector2f operator *(const FaceEngine::Matrix3f& matrix, const FaceEngine::Vector2f& vector) noexcept
+{
+    return FaceEngine::Vector2f(vector.X * matrix.M11 + vector.Y * matrix.M12 + matrix.M13, vector.X * matrix.M21 + vector.Y * matrix.M22 + matrix.M23);
+}
+
+constexpr FaceEngine::Vector3f operator *(const FaceEngine::Matrix3f& matrix, const FaceEngine::Vector3f& vector) noexcept
+{
+    return FaceEngine::Vector3f(vector.X * matrix.M11 + vector.Y * matrix.M12 + vector.Z * matrix.M13, 
+                                vector.X * matrix.M21 + vector.Y * matrix.M22 + vector.Z * matrix.M23,
+                                vector.X * matrix.M31 + vector.Y * matrix.M32 + vector.Z * matrix.M33);
+}
 
 #endif
\ No newline at end of file
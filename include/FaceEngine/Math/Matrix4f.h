@@ -1,7 +1,11 @@
 #ifndef FACEENGINE_MATH_MATRIX4F_H_
 #define FACEENGINE_MATH_MATRIX4F_H_
 
-#include "FaceEngine/Math/Matrix.h"
+#include <cstddef>
+
+#include "FaceEngine/Exception.h"
+#include "FaceEngine/Math/Rectangle.h"
+#include "FaceEngine/Math/Vector2.h"
 #include "FaceEngine/Math/Vector3.h"
 #include "FaceEngine/Math/Vector4.h"
 
@@ -10,14 +14,27 @@ namespace FaceEngine
     /**
      * @brief A 4x4 floating-point matrix.
      * 
+     * The elements are stored in row major order with each row aligned to 16 bytes, so multiplication, transposition, inversion and
+     * vector transformation load whole rows into SIMD registers (see FaceEngine/Math/SIMD.h).
      */
-    class Matrix4f : public Matrix
+    class Matrix4f
     {
     public:
-        /**
-         * @brief A matrix element in the form [row][column] (row major).
-         */
-        float M11, M12, M13, M14, M21, M22, M23, M24, M31, M32, M33, M34, M41, M42, M43, M44;
+        union alignas(16)
+        {
+            struct
+            {
+                /**
+                 * @brief A matrix element in the form [row][column] (row major).
+                 */
+                float M11, M12, M13, M14, M21, M22, M23, M24, M31, M32, M33, M34, M41, M42, M43, M44;
+            };
+
+            /**
+             * @brief The elements in row major order, the same order as operator[].
+             */
+            float Elements[16];
+        };
 
         /**
          * @brief The zero matrix, a Matrix4f filled with zeroes.
@@ -32,14 +49,7 @@ namespace FaceEngine
         /**
          * @brief Constructs a new Matrix4f object filled with zeroes.
          */
-        Matrix4f() noexcept;
-
-        /**
-         * @brief Constructs a new Matrix4f object with the same values as the Matrix4f provided.
-         * 
-         * @param matrix The Matrix4f to source values from.
-         */
-        Matrix4f(const Matrix4f& matrix) noexcept;
+        constexpr Matrix4f() noexcept;
 
         /**
          * @brief Constructs a new Matrix4f object with the values provided.
@@ -61,7 +71,7 @@ namespace FaceEngine
          * @param m43 The value at the third column of the fourth row.
          * @param m44 The value at the fourth column of the fourth row.
          */
-        Matrix4f(const float m11, const float m12, const float m13, const float m14, 
+        constexpr Matrix4f(const float m11, const float m12, const float m13, const float m14, 
                  const float m21, const float m22, const float m23, const float m24, 
                  const float m31, const float m32, const float m33, const float m34, 
                  const float m41, const float m42, const float m43, const float m44) noexcept;
@@ -74,7 +84,7 @@ namespace FaceEngine
          * @param forwardVector The k-hat basis Vector3f (forward vector).
          * @param translation A Vector3f representing translation for homogeneous transformation.
          */
-        Matrix4f(const Vector3f& rightVector, const Vector3f& upVector, const Vector3f& forwardVector, const Vector3f& translation) noexcept;
+        constexpr Matrix4f(const Vector3f& rightVector, const Vector3f& upVector, const Vector3f& forwardVector, const Vector3f& translation) noexcept;
 
         /**
          * @brief Calculates the determinant of this Matrix4f.
@@ -165,26 +175,63 @@ namespace FaceEngine
         void Transform(Vector3f& vector) const noexcept;
         void Transform(Vector4f& vector) const noexcept;
 
+        /**
+         * @brief Transforms an array of Vector2f as points on the XY plane (Z = 0, W = 1), several at a time with SIMD where available.
+         * 
+         * @param source The Vector2f to transform.
+         * @param destination The array to write the results to, which may be the source array but must not otherwise overlap it.
+         * @param count The number of Vector2f to transform.
+         */
+        void Transform(const Vector2f* source, Vector2f* destination, std::size_t count) const noexcept;
+
+        /**
+         * @brief Transforms an array of Vector3f as points (W = 1), the same as Transform(Vector3f&), several at a time with SIMD where available.
+         * 
+         * @param source The Vector3f to transform.
+         * @param destination The array to write the results to, which may be the source array but must not otherwise overlap it.
+         * @param count The number of Vector3f to transform.
+         */
+        void Transform(const Vector3f* source, Vector3f* destination, std::size_t count) const noexcept;
+
+        /**
+         * @brief Transforms an array of Vector4f, the same as Transform(Vector4f&), several at a time with SIMD where available.
+         * 
+         * @param source The Vector4f to transform.
+         * @param destination The array to write the results to, which may be the source array but must not otherwise overlap it.
+         * @param count The number of Vector4f to transform.
+         */
+        void Transform(const Vector4f* source, Vector4f* destination, std::size_t count) const noexcept;
+
+        /**
+         * @brief Calculates the axis-aligned bounding rectangle of each of an array of Rectanglef after transforming its corners as points on the XY plane.
+         * Only the affine part of this Matrix4f is used, so a perspective projection isn't applied.
+         * 
+         * @param source The Rectanglef to transform.
+         * @param destination The array to write the bounds to, which may be the source array but must not otherwise overlap it.
+         * @param count The number of Rectanglef to transform.
+         */
+        void TransformBounds(const Rectanglef* source, Rectanglef* destination, std::size_t count) const noexcept;
+
         /**
          * @brief Sets the i-hat basis Vector3f of this Matrix4f, i.e., elements M11, M21, and M31.
          * 
          * @param rightVector The i-hat basis Vector3f to set.
          */
-        void SetRight(const Vector3f& rightVector) noexcept;
+        constexpr void SetRight(const Vector3f& rightVector) noexcept;
 
         /**
          * @brief Sets the j-hat basis Vector3f of this Matrix4f, i.e., elements M12, M22, and M32.
          * 
          * @param upVector The j-hat basis Vector3f to set.
          */
-        void SetUp(const Vector3f& upVector) noexcept;
+        constexpr void SetUp(const Vector3f& upVector) noexcept;
 
         /**
          * @brief Sets the k-hat basis Vector3f of this Matrix4f, i.e., elements M13, M23, and M33.
          * 
          * @param forwardVector 
          */
-        void SetForward(const Vector3f& forwardVector) noexcept;
+        constexpr void SetForward(const Vector3f& forwardVector) noexcept;
 
         /**
          * @brief Sets the translation factors of this Matrix4f used for homogeneous transformation, i.e., elements M14, M24, and M34.
@@ -193,21 +240,21 @@ namespace FaceEngine
          * @param translationY The translation Y value.
          * @param translationZ The translation Z value.
          */
-        void SetTranslation(const float translationX, const float translationY, const float translationZ) noexcept;
+        constexpr void SetTranslation(const float translationX, const float translationY, const float translationZ) noexcept;
 
         /**
          * @brief Sets the translation factors of this Matrix4f used for homogeneous transformation, i.e., elements M14, M24, and M34.
          * 
          * @param translation The Vector3f encoding the X, Y, and Z translation values.
          */
-        void SetTranslation(const Vector3f& translation) noexcept;
+        constexpr void SetTranslation(const Vector3f& translation) noexcept;
 
         /**
          * @brief Sets the scale factors of this Matrix4f to a single value, i.e., elements M11, M22, and M33.
          * 
          * @param scale The degree to which this Matrix4f will scale a Vector3f along the X, Y, and Z axes.
          */
-        void SetScale(const float scale) noexcept;
+        constexpr void SetScale(const float scale) noexcept;
 
         /**
          * @brief Sets the scale factors of this Matrix4f, i.e., elements M11, M22, and M33.
@@ -216,42 +263,42 @@ namespace FaceEngine
          * @param scaleY The y-axis scale factor.
          * @param scaleZ The z-axis scale factor.
          */
-        void SetScale(const float scaleX, const float scaleY, const float scaleZ) noexcept;
+        constexpr void SetScale(const float scaleX, const float scaleY, const float scaleZ) noexcept;
 
         /**
          * @brief Gets the three-dimensional basis vector i-hat, i.e., elements M11, M21, and M31.
          * 
          * @return The i-hat basis vector as a Vector3f.
          */
-        Vector3f GetRight() const noexcept;
+        constexpr Vector3f GetRight() const noexcept;
 
         /**
          * @brief Gets the three-dimensional basis vector j-hat, i.e., elements M12, M22, and M32.
          * 
          * @return The j-hat basis vector as a Vector3f.
          */
-        Vector3f GetUp() const noexcept;
+        constexpr Vector3f GetUp() const noexcept;
 
         /**
          * @brief Gets the three-dimensional basis vector k-hat, i.e., elements M13, M23, and M33.
          * 
          * @return The k-hat basis vector as a Vector3f.
          */
-        Vector3f GetForward() const noexcept;
+        constexpr Vector3f GetForward() const noexcept;
 
         /**
          * @brief Gets the vector by which this Matrix4f translates Vector3f instances, i.e., elements M14, M24, and M34.
          * 
          * @return A Vector3f comprising the translation factors of this Matrix4f.
          */
-        Vector3f GetTranslation() const noexcept;
+        constexpr Vector3f GetTranslation() const noexcept;
 
         /**
          * @brief Gets the degrees to which this Matrix4f scales Vector3f instances along all axes, i.e., elements M11, M22, and M33.
          * 
          * @return A Vector3f comprising the scaling factors of this Matrix4f.
          */
-        Vector3f GetScale() const noexcept;
+        constexpr Vector3f GetScale() const noexcept;
 
         /**
          * @brief Creates a billboard transformation matrix capable of re-orienting any object such that it faces the camera. This Matrix4f operates in world coordinates.
@@ -298,7 +345,7 @@ namespace FaceEngine
          * @param zFarPlane The maximum Z-value of the view volume.
          * @return The orthographic projection matrix.
          */
-        static Matrix4f CreateOrthographic(const float width, const float height, const float zNearPlane, const float zFarPlane) noexcept;
+        static constexpr Matrix4f CreateOrthographic(const float width, const float height, const float zNearPlane, const float zFarPlane) noexcept;
 
         /**
          * @brief Creates a customised orthographic projection matrix, capable of projecting three-dimensional coordinates (e.g., a 3D scene) onto a two-dimensional plane
@@ -360,7 +407,7 @@ namespace FaceEngine
          * @param forwardVector The forward-vector of the object.
          * @return The world matrix.
          */
-        static Matrix4f CreateWorld(const Vector3f& objectPos, const Vector3f& upVector, const Vector3f& forwardVector) noexcept;
+        static constexpr Matrix4f CreateWorld(const Vector3f& objectPos, const Vector3f& upVector, const Vector3f& forwardVector) noexcept;
         //static Matrix4f CreateReflection(Plane) noexcept;
         //static Matrix4f CreateShadow(Plane, Vector3 lightSource) noexcept
 
@@ -421,7 +468,7 @@ namespace FaceEngine
          * @param scale The degree to which this Matrix4f will scale the x-, y-, and z-axes.
          * @return A scale matrix.
          */
-        static Matrix4f CreateScale(const float scale) noexcept;
+        static constexpr Matrix4f CreateScale(const float scale) noexcept;
 
         /**
          * @brief Creates a scale matrix that scales Vector3f instances by the provided factors.
@@ -431,7 +478,7 @@ namespace FaceEngine
          * @param scaleZ The z-axis scale factor.
          * @return A scale matrix.
          */
-        static Matrix4f CreateScale(const float scaleX, const float scaleY, const float scaleZ) noexcept;
+        static constexpr Matrix4f CreateScale(const float scaleX, const float scaleY, const float scaleZ) noexcept;
 
         /**
          * @brief Creates a translation matrix that translates Vector3f instances by the provided factors.
@@ -441,7 +488,7 @@ namespace FaceEngine
          * @param translationZ The z-axis translation factor.
          * @return A translation matrix.
          */
-        static Matrix4f CreateTranslation(const float translationX, const float translationY, const float translationZ) noexcept;
+        static constexpr Matrix4f CreateTranslation(const float translationX, const float translationY, const float translationZ) noexcept;
 
         /**
          * @brief Creates a translation matrix that translates Vector3f instances by the provided factors, encoded in a Vector3f.
@@ -449,7 +496,7 @@ namespace FaceEngine
          * @param translation The Vector3f encoding the x-, y-, and z-axis translation factors.
          * @return A translation matrix.
          */
-        static Matrix4f CreateTranslation(const Vector3f& translation) noexcept;
+        static constexpr Matrix4f CreateTranslation(const Vector3f& translation) noexcept;
 
         /**
          * @brief Linearly interpolates between two Matrix4f instances.
@@ -462,11 +509,20 @@ namespace FaceEngine
         static Matrix4f Lerp(const Matrix4f& firstMatrix, const Matrix4f& secondMatrix, const float t) noexcept;
 
         /**
-         * @brief Expresses this Matrix4f as an std::vector<float> in row major.
+         * @brief Returns a pointer to the sixteen elements in row major order without copying them. Pass GL_TRUE as the transpose argument when
+         * uploading it with glUniformMatrix4fv.
+         * 
+         * @return A pointer to Elements.
+         */
+        inline float* Data() noexcept { return Elements; }
+        inline const float* Data() const noexcept { return Elements; }
+
+        /**
+         * @brief Copies this Matrix4f into an std::vector<float> in column major order.
          * 
          * @return An std::vector<float> containing the elements of this Matrix4f.
          */
-        const std::vector<float> ToArray() const noexcept override;
+        const std::vector<float> ToArray() const noexcept;
 
         /**
          * @brief Expresses this Matrix4f as an std::string with newlines.
@@ -491,6 +547,156 @@ namespace FaceEngine
         float operator [](int index) const;
         float& operator [](int index);
     };
+
+    static_assert(std::is_standard_layout<Matrix4f>() && std::is_trivially_copyable<Matrix4f>() && sizeof(Matrix4f) == 16 * sizeof(float), "Matrix4f must be a plain array of floats.");
+
+    constexpr Matrix4f::Matrix4f() noexcept
+        : M11(0), M12(0), M13(0), M14(0),
+          M21(0), M22(0), M23(0), M24(0),
+          M31(0), M32(0), M33(0), M34(0),
+          M41(0), M42(0), M43(0), M44(0)
+    {
+    }
+
+    constexpr Matrix4f::Matrix4f(const float m11, const float m12, const float m13, const float m14, 
+                                 const float m21, const float m22, const float m23, const float m24, 
+                                 const float m31, const float m32, const float m33, const float m34, 
+                                 const float m41, const float m42, const float m43, const float m44) noexcept
+        : M11(m11), M12(m12), M13(m13), M14(m14),
+          M21(m21), M22(m22), M23(m23), M24(m24),
+          M31(m31), M32(m32), M33(m33), M34(m34),
+          M41(m41), M42(m42), M43(m43), M44(m44)
+    {
+    }
+
+    constexpr Matrix4f::Matrix4f(const Vector3f& rightVector, const Vector3f& upVector, const Vector3f& forwardVector, const Vector3f& translation) noexcept
+        : M11(rightVector.X), M12(upVector.X), M13(forwardVector.X), M14(translation.X),
+          M21(rightVector.Y), M22(upVector.Y), M23(forwardVector.Y), M24(translation.Y),
+          M31(rightVector.Z), M32(upVector.Z), M33(forwardVector.Z), M34(translation.Z),
+          M41(0), M42(0), M43(0), M44(1)
+    {
+    }
+
+    constexpr Matrix4f Matrix4f::Zero = Matrix4f(0, 0, 0, 0, 
+                                                 0, 0, 0, 0, 
+                                                 0, 0, 0, 0, 
+                                                 0, 0, 0, 0);
+    constexpr Matrix4f Matrix4f::Identity = Matrix4f(1, 0, 0, 0,
+                                                     0, 1, 0, 0,
+                                                     0, 0, 1, 0,
+                                                     0, 0, 0, 1);
+
+    constexpr void Matrix4f::SetRight(const Vector3f& rightVector) noexcept
+    {
+        M11 = rightVector.X;
+        M21 = rightVector.Y;
+        M31 = rightVector.Z;
+    }
+
+    constexpr void Matrix4f::SetUp(const Vector3f& upVector) noexcept
+    {
+        M12 = upVector.X;
+        M22 = upVector.Y;
+        M32 = upVector.Z;
+    }
+
+    constexpr void Matrix4f::SetForward(const Vector3f& forwardVector) noexcept
+    {
+        M13 = forwardVector.X;
+        M23 = forwardVector.Y;
+        M33 = forwardVector.Z;
+    }
+
+    constexpr void Matrix4f::SetTranslation(const float translationX, const float translationY, const float translationZ) noexcept
+    {
+        M14 = translationX;
+        M24 = translationY;
+        M34 = translationZ;
+    }
+
+    constexpr void Matrix4f::SetTranslation(const Vector3f& translation) noexcept
+    {
+        M14 = translation.X;
+        M24 = translation.Y;
+        M34 = translation.Z;
+    }
+
+    constexpr void Matrix4f::SetScale(const float scale) noexcept
+    {
+        M11 = scale;
+        M22 = scale;
+        M33 = scale;
+    }
+
+    constexpr void Matrix4f::SetScale(const float scaleX, const float scaleY, const float scaleZ) noexcept
+    {
+        M11 = scaleX;
+        M22 = scaleY;
+        M33 = scaleZ;
+    }
+
+    constexpr Vector3f Matrix4f::GetRight() const noexcept
+    {
+        return Vector3f(M11, M21, M31);
+    }
+
+    constexpr Vector3f Matrix4f::GetUp() const noexcept
+    {
+        return Vector3f(M21, M22, M23);
+    }
+
+    constexpr Vector3f Matrix4f::GetForward() const noexcept
+    {
+        return Vector3f(M31, M32, M33);
+    }
+
+    constexpr Vector3f Matrix4f::GetTranslation() const noexcept
+    {
+        return Vector3f(M14, M24, M34);
+    }
+
+    constexpr Vector3f Matrix4f::GetScale() const noexcept
+    {
+        return Vector3f(M11, M22, M33);
+    }
+
+    constexpr Matrix4f Matrix4f::CreateOrthographic(const float width, const float height, const float /* zNearPlane */, const float /* zFarPlane */) noexcept
+    {
+        return Matrix4f(2 / width, 0, 0, 0,
+                        0, 2 / height, 0, 0,
+                        0, 0, 1, 0,
+                        0, 0, 0, 1);
+    }
+
+    constexpr Matrix4f Matrix4f::CreateWorld(const Vector3f& objectPos, const Vector3f& upVector, const Vector3f& forwardVector) noexcept
+    {
+        Vector3f rightVector = upVector.Cross(forwardVector);
+
+        return Matrix4f(rightVector.X, upVector.X, forwardVector.X, objectPos.X,
+                        rightVector.Y, upVector.Y, forwardVector.Y, objectPos.Y,
+                        rightVector.Z, upVector.Z, forwardVector.Z, objectPos.Z,
+                        0, 0, 0, 1);
+    }
+
+    constexpr Matrix4f Matrix4f::CreateScale(const float scale) noexcept
+    {
+        return Matrix4f(scale, 0, 0, 0, 0, scale, 0, 0, 0, 0, scale, 0, 0, 0, 0, 1);
+    }
+
+    constexpr Matrix4f Matrix4f::CreateScale(const float scaleX, const float scaleY, const float scaleZ) noexcept
+    {
+        return Matrix4f(scaleX, 0, 0, 0, 0, scaleY, 0, 0, 0, 0, scaleZ, 0, 0, 0, 0, 1);
+    }
+
+    constexpr Matrix4f Matrix4f::CreateTranslation(const float translationX, const float translationY, const float translationZ) noexcept
+    {
+        return Matrix4f(1, 0, 0, translationX, 0, 1, 0, translationY, 0, 0, 1, translationZ, 0, 0, 0, 1);
+    }
+
+    constexpr Matrix4f Matrix4f::CreateTranslation(const Vector3f& translation) noexcept
+    {
+        return Matrix4f(1, 0, 0, translation.X, 0, 1, 0, translation.Y, 0, 0, 1, translation.Z, 0, 0, 0, 1);
+    }
 }
 
 FaceEngine::Matrix4f operator +(const FaceEngine::Matrix4f& firstMatrix, const FaceEngine::Matrix4f& secondMatrix) noexcept;
@@ -500,8 +706,23 @@ FaceEngine::Vector3f operator *(const FaceEngine::Matrix4f& matrix, const FaceEn
 FaceEngine::Vector4f operator *(const FaceEngine::Matrix4f& matrix, const FaceEngine::Vector4f& vector) noexcept;
 FaceEngine::Matrix4f operator *(const FaceEngine::Matrix4f& matrix, const float scalar) noexcept;
 FaceEngine::Matrix4f operator /(const FaceEngine::Matrix4f& matrix, const float scalar);
-bool operator ==(const FaceEngine::Matrix4f& firstMatrix, const FaceEngine::Matrix4f& secondMatrix) noexcept;
-bool operator !=(const FaceEngine::Matrix4f& firstMatrix, const FaceEngine::Matrix4f& secondMatrix) noexcept;
+
+constexpr bool operator ==(const FaceEngine::Matrix4f& firstMatrix, const FaceEngine::Matrix4f& secondMatrix) noexcept
+{
+    return firstMatrix.M11 == secondMatrix.M11 && firstMatrix.M12 == secondMatrix.M12 &&
+           firstMatrix.M13 == secondMatrix.M13 && firstMatrix.M14 == secondMatrix.M14 &&
+           firstMatrix.M21 == secondMatrix.M21 && firstMatrix.M22 == secondMatrix.M22 &&
+           firstMatrix.M23 == secondMatrix.M23 && firstMatrix.M24 == secondMatrix.M24 &&
+           firstMatrix.M31 == secondMatrix.M31 && firstMatrix.M32 == secondMatrix.M32 &&
+           firstMatrix.M33 == secondMatrix.M33 && firstMatrix.M34 == secondMatrix.M34 &&
+           firstMatrix.M41 == secondMatrix.M41 && firstMatrix.M42 == secondMatrix.M42 &&
+           firstMatrix.M43 == secondMatrix.M43 && firstMatrix.M44 == secondMatrix.M44;
+}
+
+constexpr bool operator !=(const FaceEngine::Matrix4f& firstMatrix, const FaceEngine::Matrix4f& secondMatrix) noexcept
+{
+    return !(firstMatrix == secondMatrix);
+}
 
 std::ostream& operator <<(std::ostream& cout, const FaceEngine::Matrix4f& matrix) noexcept;
 
@@ -22,61 +22,49 @@ namespace FaceEngine
         T Width;
         T Height;
 
-        inline Rectangle()
+        constexpr Rectangle() : X(0), Y(0), Width(0), Height(0)
         {
-            X = 0;
-            Y = 0;
-            Width = 0;
-            Height = 0;
         }
 
-        inline Rectangle(const Vector2f& position, const T width, const T height)
+        constexpr Rectangle(const Vector2f& position, const T width, const T height) : X(position.X), Y(position.Y), Width(width), Height(height)
         {
-            X = position.X;
-            Y = position.Y;
-            Width = width;
-            Height = height;
         }
 
-        inline Rectangle(const T x, const T y, const T width, const T height)
+        constexpr Rectangle(const T x, const T y, const T width, const T height) : X(x), Y(y), Width(width), Height(height)
         {
-            X = x;
-            Y = y;
-            Width = width;
-            Height = height;
         }
 
-        inline T GetTop() const
+        constexpr T GetTop() const
         {
             return Y;
         }
 
-        inline T GetBottom() const
+        constexpr T GetBottom() const
         {
             return Y + Height;
         }
 
-        inline T GetLeft() const
+        constexpr T GetLeft() const
         {
             return X;
         }
 
-        inline T GetRight() const
+        constexpr T GetRight() const
         {
             return X + Width;
         }
 
-        inline Vector2f GetPosition() const
+        constexpr Vector2f GetPosition() const
         {
             return Vector2f(X, Y);
         }
 
-        inline Vector2f GetCentre() const
+        constexpr Vector2f GetCentre() const
         {
             return Vector2f(X + (Width / 2), Y + (Height / 2));
         }
 
-        inline Vector2f GetSize() const
+        constexpr Vector2f GetSize() const
         {
             return Vector2f(Width, Height);
         }
@@ -86,47 +74,50 @@ namespace FaceEngine
             return "Rectangle[X: " + std::to_string(X) + ", Y: " + std::to_string(Y) + ", Width: " + std::to_string(Width) + ", Height: " + std::to_string(Height) + "]";
         }
 
-        inline bool Contains(const Vector2f& vector) const
+        constexpr bool Contains(const Vector2f& vector) const
         {
             return (vector.X >= X) && (vector.X <= GetRight()) && (vector.Y >= Y) && (vector.Y <= GetBottom());
         }
 
-        inline bool CompletelyContains(const Vector2f& vector) const
+        constexpr bool CompletelyContains(const Vector2f& vector) const
         {
             return (vector.X > X) && (vector.X < GetRight()) && (vector.Y > Y) && (vector.Y < GetBottom());
         }
 
-        inline bool Contains(const Rectangle<T>& rect) const
+        constexpr bool Contains(const Rectangle<T>& rect) const
         {
             return (X <= rect.X) && (GetRight() >= rect.GetRight()) && (Y <= rect.Y) && (GetBottom() >= rect.GetBottom());
         }
 
-        inline bool CompletelyContains(const Rectangle<T>& rect) const
+        constexpr bool CompletelyContains(const Rectangle<T>& rect) const
         {
             return (X < rect.X) && (GetRight() > rect.GetRight()) && (Y < rect.Y) && (GetBottom() > rect.GetBottom());
         }
 
-        inline bool Intersects(const Rectangle<T>& rect) const
+        constexpr bool Intersects(const Rectangle<T>& rect) const
         {
             return (X < rect.GetRight()) && (GetRight() > rect.GetLeft()) && (Y < rect.GetBottom()) && (GetBottom() > rect.Y);
         }
 
-        inline bool IntersectsOrTouches(const Rectangle<T>& rect) const
+        constexpr bool IntersectsOrTouches(const Rectangle<T>& rect) const
         {
             return (X <= rect.GetRight()) && (GetRight() >= rect.GetLeft()) && (Y <= rect.GetBottom()) && (GetBottom() >= rect.Y);
         }
 
-        inline bool Equals(const Rectangle<T>& rect) const
+        constexpr bool Equals(const Rectangle<T>& rect) const
         {
             return (X == rect.X) && (Y == rect.Y) && (Width == rect.Width) && (Height == rect.Height);
         }
 
-        inline void operator+=(const Rectangle<T>& rect) noexcept
+        constexpr void operator+=(const Rectangle<T>& rect) noexcept
         {
+            T right = std::max(GetRight(), rect.GetRight());
+            T bottom = std::max(GetBottom(), rect.GetBottom());
+
             X = std::min(X, rect.X);
             Y = std::min(Y, rect.Y);
-            Width = std::max(GetRight() - X, rect.GetRight() - X);
-            Height = std::max(GetBottom() - Y, rect.GetBottom() - Y);
+            Width = right - X;
+            Height = bottom - Y;
         }
     };
 
@@ -139,13 +130,24 @@ std::ostream& operator <<(std::ostream& os, const FaceEngine::Rectangle<T>& rect
     return os << rect.ToString();
 }
 
-template <class T>
-FaceEngine::Rectangle<T> operator+(const FaceEngine::Rectangle<T>& firstRect, const FaceEngine::Rectangle<T>& secondRect) noexcept;
+template <typename T>
+constexpr FaceEngine::Rectangle<T> operator+(const FaceEngine::Rectangle<T>& firstRect, const FaceEngine::Rectangle<T>& secondRect) noexcept
+{
+    FaceEngine::Rectangle<T> rect = firstRect;
+    rect += secondRect;
+    return rect;
+}
 
-template <class T>
-bool operator==(const FaceEngine::Rectangle<T>& firstRect, const FaceEngine::Rectangle<T>& secondRect) noexcept;
+template <typename T>
+constexpr bool operator==(const FaceEngine::Rectangle<T>& firstRect, const FaceEngine::Rectangle<T>& secondRect) noexcept
+{
+    return firstRect.Equals(secondRect);
+}
 
-template <class T>
-bool operator!=(const FaceEngine::Rectangle<T>& firstRect, const FaceEngine::Rectangle<T>& secondRect) noexcept;
+template <typename T>
+constexpr bool operator!=(const FaceEngine::Rectangle<T>& firstRect, const FaceEngine::Rectangle<T>& secondRect) noexcept
+{
+    return !firstRect.Equals(secondRect);
+}
 
 #endif
\ No newline at end of file
@@ -0,0 +1,41 @@
+#ifndef FACEENGINE_MATH_SIMD_H_
+#define FACEENGINE_MATH_SIMD_H_
+
+/**
+ * @brief Selects the SIMD instruction set used by the math types at compile time.
+ *
+ * FACE_ENGINE_SSE is defined on every x86-64 target, and FACE_ENGINE_AVX as well when compiling with AVX enabled (such as with FACE_ENGINE_NATIVE).
+ * FACE_ENGINE_NEON is defined on ARM targets with NEON. Define FACE_ENGINE_NO_SIMD to use the scalar implementations everywhere.
+ */
+#ifndef FACE_ENGINE_NO_SIMD
+#if defined(__SSE__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 1)
+#define FACE_ENGINE_SSE
+#include <xmmintrin.h>
+
+#ifdef __AVX__
+#define FACE_ENGINE_AVX
+#include <immintrin.h>
+#endif
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#define FACE_ENGINE_NEON
+#include <arm_neon.h>
+#endif
+#endif
+
+namespace FaceEngine
+{
+    /**
+     * @brief The name of the SIMD instruction set the math types were compiled for: "avx", "sse", "neon" or "none".
+     */
+#if defined(FACE_ENGINE_AVX)
+    constexpr const char* SIMDInstructionSet = "avx";
+#elif defined(FACE_ENGINE_SSE)
+    constexpr const char* SIMDInstructionSet = "sse";
+#elif defined(FACE_ENGINE_NEON)
+    constexpr const char* SIMDInstructionSet = "neon";
+#else
+    constexpr const char* SIMDInstructionSet = "none";
+#endif
+}
+
+#endif
\ No newline at end of file
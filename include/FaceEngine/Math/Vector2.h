@@ -1,15 +1,18 @@
 #ifndef FACEENGINE_MATH_VECTOR2_H_
 #define FACEENGINE_MATH_VECTOR2_H_
 
-#include "FaceEngine/Math/Vector.h"
+#include "FaceEngine/Exception.h"
 #include <iostream>
 #include <cmath>
 #include <algorithm>
+#include <cstdint>
+#include <type_traits>
+#include <vector>
 
 namespace FaceEngine
 {
     template <typename T>
-    class Vector2 : public Vector
+    class Vector2
     {
     static_assert(std::is_same<float, T>() || 
                   std::is_same<double, T>() ||
@@ -30,25 +33,19 @@ namespace FaceEngine
         static const Vector2 UnitX;
         static const Vector2 UnitY;
 
-        Vector2() noexcept
+        constexpr Vector2() noexcept : X(0), Y(0)
         {
-            X = 0;
-            Y = 0;
         }
 
-        Vector2(T value) noexcept
+        constexpr Vector2(T value) noexcept : X(value), Y(value)
         {
-            X = value;
-            Y = value;
         }
 
-        Vector2(T x, T y) noexcept
+        constexpr Vector2(T x, T y) noexcept : X(x), Y(y)
         {
-            X = x;
-            Y = y;
         }
 
-        float Dot(const Vector2<T>& vector) const noexcept
+        constexpr float Dot(const Vector2<T>& vector) const noexcept
         {
             return (X * vector.X) + (Y * vector.Y);
         }
@@ -63,7 +60,7 @@ namespace FaceEngine
             return sqrt(((X - vector.X) * (X - vector.X)) + ((Y - vector.Y) * (Y - vector.Y)));
         }
 
-        float DistanceSquared(const Vector2<T>& vector) const noexcept
+        constexpr float DistanceSquared(const Vector2<T>& vector) const noexcept
         {
             return ((X - vector.X) * (X - vector.X)) + ((Y - vector.Y) * (Y - vector.Y));
         }
@@ -73,31 +70,31 @@ namespace FaceEngine
             return "Vector2[X: " + std::to_string(X) + ", Y: " + std::to_string(Y) + "]";
         }
 
-        void Add(const Vector2<T>& vector) noexcept
+        constexpr void Add(const Vector2<T>& vector) noexcept
         {
             X += vector.X;
             Y += vector.Y;
         }
 
-        void Subtract(const Vector2<T>& vector) noexcept
+        constexpr void Subtract(const Vector2<T>& vector) noexcept
         {
             X -= vector.X;
             Y -= vector.Y;
         }
 
-        void Multiply(const float scalar) noexcept
+        constexpr void Multiply(const float scalar) noexcept
         {
             X *= scalar;
             Y *= scalar;
         }
 
-        void Multiply(const Vector2<T>& vector) noexcept
+        constexpr void Multiply(const Vector2<T>& vector) noexcept
         {
             X *= vector.X;
             Y *= vector.Y;
         }
 
-        void Divide(const float scalar)
+        constexpr void Divide(const float scalar)
         {
             if (scalar == 0)
             {
@@ -108,12 +105,12 @@ namespace FaceEngine
             Y /= scalar;
         }
 
-        bool Equals(const Vector2<T>& vector) const noexcept
+        constexpr bool Equals(const Vector2<T>& vector) const noexcept
         {
             return X == vector.X && Y == vector.Y;
         }
 
-        void Negate() noexcept
+        constexpr void Negate() noexcept
         {
             X = -X;
             Y = -Y;
@@ -137,7 +134,7 @@ namespace FaceEngine
             Y = roundf(Y);
         }
 
-        void Clamp(const Vector2<T>& firstBound, const Vector2<T>& secondBound) noexcept
+        constexpr void Clamp(const Vector2<T>& firstBound, const Vector2<T>& secondBound) noexcept
         {
             X = std::clamp(X, std::min(firstBound.X, secondBound.X), std::max(firstBound.X, secondBound.X));
             Y = std::clamp(Y, std::min(firstBound.Y, secondBound.Y), std::max(firstBound.Y, secondBound.Y));
@@ -154,31 +151,31 @@ namespace FaceEngine
             }
         }
 
-        void operator +=(const Vector2<T>& vector) noexcept
+        constexpr void operator +=(const Vector2<T>& vector) noexcept
         {
             X += vector.X;
             Y += vector.Y;
         }
 
-        void operator -=(const Vector2<T>& vector) noexcept
+        constexpr void operator -=(const Vector2<T>& vector) noexcept
         {
             X -= vector.X;
             Y -= vector.Y;
         }
 
-        void operator *=(const float scalar) noexcept
+        constexpr void operator *=(const float scalar) noexcept
         {
             X *= scalar;
             Y *= scalar;
         }
 
-        void operator *=(const Vector2<T>& vector) noexcept
+        constexpr void operator *=(const Vector2<T>& vector) noexcept
         {
             X *= vector.X;
             Y *= vector.Y;
         }
 
-        void operator /=(const float scalar)
+        constexpr void operator /=(const float scalar)
         {
             if (scalar == 0)
             {
@@ -189,12 +186,12 @@ namespace FaceEngine
             Y /= scalar;
         }
 
-        Vector2<T> operator -() const noexcept
+        constexpr Vector2<T> operator -() const noexcept
         {
-            return Vector2f(-X, -Y);
+            return Vector2<T>(-X, -Y);
         }
 
-        float operator [](int index) const
+        constexpr float operator [](int index) const
         {
             if (index == 0)
             {
@@ -210,7 +207,7 @@ namespace FaceEngine
             }
         }
 
-        float& operator [](int index)
+        constexpr float& operator [](int index)
         {
             if (index == 0)
             {
@@ -226,22 +223,35 @@ namespace FaceEngine
             }
         }
 
-        static Vector2<T> Max(const Vector2<T>& firstVector, const Vector2<T>& secondVector) noexcept
+        static constexpr Vector2<T> Max(const Vector2<T>& firstVector, const Vector2<T>& secondVector) noexcept
         {
-            return Vector2f(std::max(firstVector.X, secondVector.X), std::max(firstVector.Y, secondVector.Y));
+            return Vector2<T>(std::max(firstVector.X, secondVector.X), std::max(firstVector.Y, secondVector.Y));
         }
 
-        static Vector2<T> Min(const Vector2<T>& firstVector, const Vector2<T>& secondVector) noexcept
+        static constexpr Vector2<T> Min(const Vector2<T>& firstVector, const Vector2<T>& secondVector) noexcept
         {
-            return Vector2f(std::min(firstVector.X, secondVector.X), std::min(firstVector.Y, secondVector.Y));
+            return Vector2<T>(std::min(firstVector.X, secondVector.X), std::min(firstVector.Y, secondVector.Y));
         }
 
-        static Vector2<T> Lerp(const Vector2<T>& firstVector, const Vector2<T>& secondVector, const float t) noexcept
+        static constexpr Vector2<T> Lerp(const Vector2<T>& firstVector, const Vector2<T>& secondVector, const float t) noexcept
         {
-            return Vector2f(firstVector.X + (secondVector.X - firstVector.X) * t, firstVector.Y + (secondVector.Y - firstVector.Y) * t);
+            return Vector2<T>(firstVector.X + (secondVector.X - firstVector.X) * t, firstVector.Y + (secondVector.Y - firstVector.Y) * t);
         }
 
-        const std::vector<float> ToArray() const noexcept override
+        /**
+         * @brief Returns a pointer to the two contiguous components, X then Y, without copying them.
+         */
+        constexpr T* Data() noexcept
+        {
+            return &X;
+        }
+
+        constexpr const T* Data() const noexcept
+        {
+            return &X;
+        }
+
+        const std::vector<float> ToArray() const noexcept
         {
             return {(float)X, (float)Y};
         }
@@ -251,43 +261,45 @@ namespace FaceEngine
 }
 
 template <typename T>
-const FaceEngine::Vector2<T> FaceEngine::Vector2<T>::Zero(0, 0);
+constexpr FaceEngine::Vector2<T> FaceEngine::Vector2<T>::Zero(0, 0);
 
 template <typename T>
-const FaceEngine::Vector2<T> FaceEngine::Vector2<T>::One(1, 1);
+constexpr FaceEngine::Vector2<T> FaceEngine::Vector2<T>::One(1, 1);
 
 template <typename T>
-const FaceEngine::Vector2<T> FaceEngine::Vector2<T>::UnitX(1, 0);
+constexpr FaceEngine::Vector2<T> FaceEngine::Vector2<T>::UnitX(1, 0);
 
 template <typename T>
-const FaceEngine::Vector2<T> FaceEngine::Vector2<T>::UnitY(0, 1);
+constexpr FaceEngine::Vector2<T> FaceEngine::Vector2<T>::UnitY(0, 1);
+
+static_assert(std::is_standard_layout<FaceEngine::Vector2f>() && std::is_trivially_copyable<FaceEngine::Vector2f>() && sizeof(FaceEngine::Vector2f) == 2 * sizeof(float), "Vector2f must be a plain pair of floats.");
 
 template <typename T>
-FaceEngine::Vector2<T> operator +(const FaceEngine::Vector2<T>& firstVector, const FaceEngine::Vector2<T>& secondVector) noexcept
+constexpr FaceEngine::Vector2<T> operator +(const FaceEngine::Vector2<T>& firstVector, const FaceEngine::Vector2<T>& secondVector) noexcept
 {
     return FaceEngine::Vector2<T>(firstVector.X + secondVector.X, firstVector.Y + secondVector.Y);
 }
 
 template <typename T>
-FaceEngine::Vector2<T> operator -(const FaceEngine::Vector2<T>& firstVector, const FaceEngine::Vector2<T>& secondVector) noexcept
+constexpr FaceEngine::Vector2<T> operator -(const FaceEngine::Vector2<T>& firstVector, const FaceEngine::Vector2<T>& secondVector) noexcept
 {
     return FaceEngine::Vector2<T>(firstVector.X - secondVector.X, firstVector.Y - secondVector.Y);
 }
 
 template <typename T>
-FaceEngine::Vector2<T> operator *(const FaceEngine::Vector2<T>& vector, const float scalar) noexcept
+constexpr FaceEngine::Vector2<T> operator *(const FaceEngine::Vector2<T>& vector, const float scalar) noexcept
 {
     return FaceEngine::Vector2<T>(vector.X * scalar, vector.Y * scalar);
 }
 
 template <typename T>
-FaceEngine::Vector2<T> operator *(const FaceEngine::Vector2<T>& firstVector, const FaceEngine::Vector2<T>& secondVector) noexcept
+constexpr FaceEngine::Vector2<T> operator *(const FaceEngine::Vector2<T>& firstVector, const FaceEngine::Vector2<T>& secondVector) noexcept
 {
     return FaceEngine::Vector2<T>(firstVector.X * secondVector.X, firstVector.Y * secondVector.Y);
 }
 
 template <typename T>
-FaceEngine::Vector2<T> operator /(const FaceEngine::Vector2<T>& vector, const float scalar)
+constexpr FaceEngine::Vector2<T> operator /(const FaceEngine::Vector2<T>& vector, const float scalar)
 {
     if (scalar == 0)
     {
@@ -298,13 +310,13 @@ FaceEngine::Vector2<T> operator /(const FaceEngine::Vector2<T>& vector, const fl
 }
 
 template <typename T>
-bool operator ==(const FaceEngine::Vector2<T>& firstVector, const FaceEngine::Vector2<T>& secondVector) noexcept
+constexpr bool operator ==(const FaceEngine::Vector2<T>& firstVector, const FaceEngine::Vector2<T>& secondVector) noexcept
 {
     return firstVector.X == secondVector.X && firstVector.Y == secondVector.Y;
 }
 
 template <typename T>
-bool operator !=(const FaceEngine::Vector2<T>& firstVector, const FaceEngine::Vector2<T>& secondVector) noexcept
+constexpr bool operator !=(const FaceEngine::Vector2<T>& firstVector, const FaceEngine::Vector2<T>& secondVector) noexcept
 {
     return firstVector.X != secondVector.X || firstVector.Y != secondVector.Y;
 }
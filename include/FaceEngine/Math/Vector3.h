@@ -1,13 +1,12 @@
 #ifndef FACEENGINE_MATH_VECTOR3_H_
 #define FACEENGINE_MATH_VECTOR3_H_
 
-#include "FaceEngine/Math/Vector.h"
 #include "FaceEngine/Math/Vector2.h"
 
 namespace FaceEngine
 {
     template <typename T>
-    class Vector3 : FaceEngine::Vector
+    class Vector3
     {
     static_assert(std::is_same<float, T>() || 
                 std::is_same<int, T>() || 
@@ -25,40 +24,28 @@ namespace FaceEngine
         static const Vector3 UnitY;
         static const Vector3 UnitZ;
 
-        Vector3() noexcept
+        constexpr Vector3() noexcept : X(0), Y(0), Z(0)
         {
-            X = 0;
-            Y = 0;
-            Z = 0;
         }
 
-        Vector3(T value) noexcept
+        constexpr Vector3(T value) noexcept : X(value), Y(value), Z(value)
         {
-            X = value;
-            Y = value;
-            Z = value;
         }
 
-        Vector3(const Vector2<T>& vector, T z) noexcept
+        constexpr Vector3(const Vector2<T>& vector, T z) noexcept : X(vector.X), Y(vector.Y), Z(z)
         {
-            X = vector.X;
-            Y = vector.Y;
-            Z = z;
         }
 
-        Vector3(T x, T y, T z) noexcept
+        constexpr Vector3(T x, T y, T z) noexcept : X(x), Y(y), Z(z)
         {
-            X = x;
-            Y = y;
-            Z = z;
         }
 
-        float Dot(const Vector3& vector) const noexcept
+        constexpr float Dot(const Vector3& vector) const noexcept
         {
             return (X * vector.X) + (Y * vector.Y) + (Z * vector.Z);
         }
 
-        Vector3<T> Cross(const Vector3& vector) const noexcept
+        constexpr Vector3<T> Cross(const Vector3& vector) const noexcept
         {
             return Vector3<T>(Y * vector.Z - Z * vector.Y, Z * vector.X - X * vector.Z, X * vector.Y - Y * vector.X);
         }
@@ -83,47 +70,47 @@ namespace FaceEngine
             return "[X: " + std::to_string(X) + ", Y: " + std::to_string(Y) + ", Z: " + std::to_string(Z) + "]";
         }
 
-        void Add(const Vector3& vector) noexcept
+        constexpr void Add(const Vector3& vector) noexcept
         {
             X += vector.X;
             Y += vector.Y;
             Z += vector.Z;
         }
 
-        void Subtract(const Vector3& vector) noexcept
+        constexpr void Subtract(const Vector3& vector) noexcept
         {
             X -= vector.X;
             Y -= vector.Y;
             Z -= vector.Z;
         }
 
-        void Multiply(const float scalar) noexcept
+        constexpr void Multiply(const float scalar) noexcept
         {
             X *= scalar;
             Y *= scalar;
             Z *= scalar;
         }
 
-        void Multiply(const Vector3& vector) noexcept
+        constexpr void Multiply(const Vector3& vector) noexcept
         {
             X *= vector.X;
             Y *= vector.Y;
             Z *= vector.Z;
         }
 
-        void Divide(const float scalar)
+        constexpr void Divide(const float scalar)
         {
             X /= scalar;
             Y /= scalar;
             Z /= scalar;
         }
 
-        bool Equals(const Vector3& vector) const noexcept
+        constexpr bool Equals(const Vector3& vector) const noexcept
         {
             return X == vector.X && Y == vector.Y && Z == vector.Z;
         }
 
-        void Negate() noexcept
+        constexpr void Negate() noexcept
         {
             X = -X;
             Y = -Y;
@@ -151,7 +138,7 @@ namespace FaceEngine
             Z = round(Z);
         }
 
-        void Clamp(const Vector3& firstBound, const Vector3& secondBound) noexcept
+        constexpr void Clamp(const Vector3& firstBound, const Vector3& secondBound) noexcept
         {
             X = std::clamp(X, std::min(firstBound.X, secondBound.X), std::max(firstBound.X, secondBound.X));
             Y = std::clamp(Y, std::min(firstBound.Y, secondBound.Y), std::max(firstBound.Y, secondBound.Y));
@@ -170,35 +157,35 @@ namespace FaceEngine
             }
         }
 
-        void operator +=(const Vector3& vector) noexcept
+        constexpr void operator +=(const Vector3& vector) noexcept
         {
             X += vector.X;
             Y += vector.Y;
             Z += vector.Z;
         }
         
-        void operator -=(const Vector3& vector) noexcept
+        constexpr void operator -=(const Vector3& vector) noexcept
         {
             X -= vector.X;
             Y -= vector.Y;
             Z -= vector.Z;
         }
 
-        void operator *=(const T scalar) noexcept
+        constexpr void operator *=(const T scalar) noexcept
         {
             X *= scalar;
             Y *= scalar;
             Z *= scalar;
         }
 
-        void operator *=(const Vector3& vector) noexcept
+        constexpr void operator *=(const Vector3& vector) noexcept
         {
             X *= vector.X;
             Y *= vector.Y;
             Z *= vector.Z;
         }
 
-        void operator /=(const T scalar)
+        constexpr void operator /=(const T scalar)
         {
             if (scalar == 0)
             {
@@ -210,12 +197,12 @@ namespace FaceEngine
             Z /= scalar;
         }
 
-        Vector3<T> operator -() const noexcept
+        constexpr Vector3<T> operator -() const noexcept
         {
             return Vector3<T>(-X, -Y, -Z);
         }
 
-        T operator [](int index) const
+        constexpr T operator [](int index) const
         {
             if (index == 0)
             {
@@ -235,7 +222,7 @@ namespace FaceEngine
             }
         }
 
-        T& operator [](int index)
+        constexpr T& operator [](int index)
         {
             if (index == 0)
             {
@@ -255,22 +242,35 @@ namespace FaceEngine
             }
         }
 
-        static Vector3<T> Max(const Vector3& firstVector, const Vector3& secondVector) noexcept
+        static constexpr Vector3<T> Max(const Vector3& firstVector, const Vector3& secondVector) noexcept
         {
             return Vector3<T>(std::max(firstVector.X, secondVector.X), std::max(firstVector.Y, secondVector.Y), std::max(firstVector.Z, secondVector.Z));
         }
 
-        static Vector3<T> Min(const Vector3& firstVector, const Vector3& secondVector) noexcept
+        static constexpr Vector3<T> Min(const Vector3& firstVector, const Vector3& secondVector) noexcept
         {
             return Vector3<T>(std::min(firstVector.X, secondVector.X), std::min(firstVector.Y, secondVector.Y), std::min(firstVector.Z, secondVector.Z));
         }
 
-        static Vector3<T> Lerp(const Vector3& firstVector, const Vector3& secondVector, const float t) noexcept
+        static constexpr Vector3<T> Lerp(const Vector3& firstVector, const Vector3& secondVector, const float t) noexcept
         {
             return Vector3<T>(firstVector.X + (secondVector.X - firstVector.X) * t, firstVector.Y + (secondVector.Y - firstVector.Y) * t, firstVector.Z + (secondVector.Z - firstVector.Z) * t);
         }
 
-        const std::vector<float> ToArray() const noexcept override
+        /**
+         * @brief Returns a pointer to the three contiguous components, X, Y then Z, without copying them.
+         */
+        constexpr T* Data() noexcept
+        {
+            return &X;
+        }
+
+        constexpr const T* Data() const noexcept
+        {
+            return &X;
+        }
+
+        const std::vector<float> ToArray() const noexcept
         {
             return {(float)X, (float)Y, (float)Z};
         }
@@ -280,46 +280,48 @@ namespace FaceEngine
 }
 
 template <typename T>
-const FaceEngine::Vector3<T> FaceEngine::Vector3<T>::Zero(0, 0, 0);
+constexpr FaceEngine::Vector3<T> FaceEngine::Vector3<T>::Zero(0, 0, 0);
 
 template <typename T>
-const FaceEngine::Vector3<T> FaceEngine::Vector3<T>::One(1, 1, 1);
+constexpr FaceEngine::Vector3<T> FaceEngine::Vector3<T>::One(1, 1, 1);
 
 template <typename T>
-const FaceEngine::Vector3<T> FaceEngine::Vector3<T>::UnitX(1, 0, 0);
+constexpr FaceEngine::Vector3<T> FaceEngine::Vector3<T>::UnitX(1, 0, 0);
 
 template <typename T>
-const FaceEngine::Vector3<T> FaceEngine::Vector3<T>::UnitY(0, 1, 0);
+constexpr FaceEngine::Vector3<T> FaceEngine::Vector3<T>::UnitY(0, 1, 0);
 
 template <typename T>
-const FaceEngine::Vector3<T> FaceEngine::Vector3<T>::UnitZ(0, 0, 1);
+constexpr FaceEngine::Vector3<T> FaceEngine::Vector3<T>::UnitZ(0, 0, 1);
+
+static_assert(std::is_standard_layout<FaceEngine::Vector3f>() && std::is_trivially_copyable<FaceEngine::Vector3f>() && sizeof(FaceEngine::Vector3f) == 3 * sizeof(float), "Vector3f must be a plain triple of floats.");
 
 template <typename T>
-FaceEngine::Vector3<T> operator +(const FaceEngine::Vector3<T>& firstVector, const FaceEngine::Vector3<T>& secondVector) noexcept
+constexpr FaceEngine::Vector3<T> operator +(const FaceEngine::Vector3<T>& firstVector, const FaceEngine::Vector3<T>& secondVector) noexcept
 {
     return FaceEngine::Vector3<T>(firstVector.X + secondVector.X, firstVector.Y + secondVector.Y, firstVector.Z + secondVector.Z);
 }
 
 template <typename T>
-FaceEngine::Vector3<T> operator -(const FaceEngine::Vector3<T>& firstVector, const FaceEngine::Vector3<T>& secondVector) noexcept
+constexpr FaceEngine::Vector3<T> operator -(const FaceEngine::Vector3<T>& firstVector, const FaceEngine::Vector3<T>& secondVector) noexcept
 {
     return FaceEngine::Vector3<T>(firstVector.X - secondVector.X, firstVector.Y - secondVector.Y, firstVector.Z - secondVector.Z);
 }
 
 template <typename T>
-FaceEngine::Vector3<T> operator *(const FaceEngine::Vector3<T>& vector, const float scalar) noexcept
+constexpr FaceEngine::Vector3<T> operator *(const FaceEngine::Vector3<T>& vector, const float scalar) noexcept
 {
     return FaceEngine::Vector3<T>(vector.X * scalar, vector.Y * scalar, vector.Z * scalar);
 }
 
 template <typename T>
-FaceEngine::Vector3<T> operator *(const FaceEngine::Vector3<T>& firstVector, const FaceEngine::Vector3<T>& secondVector) noexcept
+constexpr FaceEngine::Vector3<T> operator *(const FaceEngine::Vector3<T>& firstVector, const FaceEngine::Vector3<T>& secondVector) noexcept
 {
     return FaceEngine::Vector3<T>(firstVector.X * secondVector.X, firstVector.Y * secondVector.Y, firstVector.Z * secondVector.Z);
 }
 
 template <typename T>
-FaceEngine::Vector3<T> operator /(const FaceEngine::Vector3<T>& vector, const float scalar)
+constexpr FaceEngine::Vector3<T> operator /(const FaceEngine::Vector3<T>& vector, const float scalar)
 {
     if (scalar == 0)
     {
@@ -330,13 +332,13 @@ FaceEngine::Vector3<T> operator /(const FaceEngine::Vector3<T>& vector, const fl
 }
 
 template <typename T>
-bool operator ==(const FaceEngine::Vector3<T>& firstVector, const FaceEngine::Vector3<T>& secondVector) noexcept
+constexpr bool operator ==(const FaceEngine::Vector3<T>& firstVector, const FaceEngine::Vector3<T>& secondVector) noexcept
 {
     return firstVector.X == secondVector.X && firstVector.Y == secondVector.Y && firstVector.Z == secondVector.Z;
 }
 
 template <typename T>
-bool operator !=(const FaceEngine::Vector3<T>& firstVector, const FaceEngine::Vector3<T>& secondVector) noexcept
+constexpr bool operator !=(const FaceEngine::Vector3<T>& firstVector, const FaceEngine::Vector3<T>& secondVector) noexcept
 {
     return firstVector.X != secondVector.X || firstVector.Y != secondVector.Y || firstVector.Z != secondVector.Z;
 }
@@ -1,14 +1,13 @@
 #ifndef FACEENGINE_MATH_VECTOR4_H_
 #define FACEENGINE_MATH_VECTOR4_H_
 
-#include "FaceEngine/Math/Vector.h"
 #include "FaceEngine/Math/Vector3.h"
 #include <iostream>
 
 namespace FaceEngine
 {
     template <typename T>
-    class Vector4 : Vector
+    class Vector4
     {
     static_assert(std::is_same<float, T>() || 
             std::is_same<int, T>() || 
@@ -28,47 +27,27 @@ namespace FaceEngine
         static const Vector4 UnitZ;
         static const Vector4 UnitW;
 
-        Vector4() noexcept
+        constexpr Vector4() noexcept : X(0), Y(0), Z(0), W(0)
         {
-            X = 0;
-            Y = 0;
-            Z = 0;
-            W = 0;
         }
 
-        Vector4(float value) noexcept
+        constexpr Vector4(float value) noexcept : X(value), Y(value), Z(value), W(value)
         {
-            X = value;
-            Y = value;
-            Z = value;
-            W = value;
         }
 
-        Vector4(const Vector2f& vector, float z, float w) noexcept
+        constexpr Vector4(const Vector2f& vector, float z, float w) noexcept : X(vector.X), Y(vector.Y), Z(z), W(w)
         {
-            X = vector.X;
-            Y = vector.Y;
-            Z = z;
-            W = w;
         }
 
-        Vector4(const Vector3f& vector, float w) noexcept
+        constexpr Vector4(const Vector3f& vector, float w) noexcept : X(vector.X), Y(vector.Y), Z(vector.Z), W(w)
         {
-            X = vector.X;
-            Y = vector.Y;
-            Z = vector.Z;
-            W = w;
         }
 
-        Vector4(float x, float y, float z, float w) noexcept
+        constexpr Vector4(float x, float y, float z, float w) noexcept : X(x), Y(y), Z(z), W(w)
         {
-            X = x;
-            Y = y;
-            Z = z;
-            W = w;
         }
 
-        float Dot(const Vector4& vector) const noexcept
+        constexpr float Dot(const Vector4& vector) const noexcept
         {
             return (X * vector.X) + (Y * vector.Y) + (Z * vector.Z) + (W * vector.W);
         }
@@ -88,7 +67,7 @@ namespace FaceEngine
             return "Vector4f[X: " + std::to_string(X) + ", Y: " + std::to_string(Y) + ", Z: " + std::to_string(Z) + ", W: " + std::to_string(W) + "]";
         }
 
-        void Add(const Vector4& vector) noexcept
+        constexpr void Add(const Vector4& vector) noexcept
         {
             X += vector.X;
             Y += vector.Y;
@@ -96,7 +75,7 @@ namespace FaceEngine
             W += vector.W;
         }
 
-        void Subtract(const Vector4& vector) noexcept
+        constexpr void Subtract(const Vector4& vector) noexcept
         {
             X -= vector.X;
             Y -= vector.Y;
@@ -104,7 +83,7 @@ namespace FaceEngine
             W -= vector.W;
         }
 
-        void Multiply(const float scalar) noexcept
+        constexpr void Multiply(const float scalar) noexcept
         {
             X *= scalar;
             Y *= scalar;
@@ -112,7 +91,7 @@ namespace FaceEngine
             W *= scalar;
         }
 
-        void Multiply(const Vector4& vector) noexcept
+        constexpr void Multiply(const Vector4& vector) noexcept
         {
             X *= vector.X;
             Y *= vector.Y;
@@ -120,7 +99,7 @@ namespace FaceEngine
             W *= vector.W;
         }
 
-        void Divide(const float scalar)
+        constexpr void Divide(const float scalar)
         {
             if (scalar == 0)
             {
@@ -133,12 +112,12 @@ namespace FaceEngine
             W /= scalar;
         }
 
-        bool Equals(const Vector4& vector) const noexcept
+        constexpr bool Equals(const Vector4& vector) const noexcept
         {
             return X == vector.X && Y == vector.Y && Z == vector.Z && W == vector.W;
         }
 
-        void Negate() noexcept
+        constexpr void Negate() noexcept
         {
             X = -X;
             Y = -Y;
@@ -178,7 +157,7 @@ namespace FaceEngine
             W = abs(W);
         }
 
-        void Clamp(const Vector4& firstBound, const Vector4& secondBound) noexcept
+        constexpr void Clamp(const Vector4& firstBound, const Vector4& secondBound) noexcept
         {
             X = std::clamp(X, std::min(firstBound.X, secondBound.X), std::max(firstBound.X, secondBound.X));
             Y = std::clamp(Y, std::min(firstBound.Y, secondBound.Y), std::max(firstBound.Y, secondBound.Y));
@@ -199,7 +178,7 @@ namespace FaceEngine
             }
         }
 
-        void operator +=(const Vector4& vector) noexcept
+        constexpr void operator +=(const Vector4& vector) noexcept
         {
             X += vector.X;
             Y += vector.Y;
@@ -207,7 +186,7 @@ namespace FaceEngine
             W += vector.W;
         }
 
-        void operator -=(const Vector4& vector) noexcept
+        constexpr void operator -=(const Vector4& vector) noexcept
         {
             X -= vector.X;
             Y -= vector.Y;
@@ -215,7 +194,7 @@ namespace FaceEngine
             W -= vector.W;
         }
 
-        void operator *=(const float scalar) noexcept
+        constexpr void operator *=(const float scalar) noexcept
         {
             X *= scalar;
             Y *= scalar;
@@ -223,7 +202,7 @@ namespace FaceEngine
             W *= scalar;
         }
 
-        void operator *=(const Vector4& vector) noexcept
+        constexpr void operator *=(const Vector4& vector) noexcept
         {
             X *= vector.X;
             Y *= vector.Y;
@@ -231,7 +210,7 @@ namespace FaceEngine
             W *= vector.W;
         }
 
-        void operator /=(const float scalar)
+        constexpr void operator /=(const float scalar)
         {
             if (scalar == 0)
             {
@@ -244,12 +223,12 @@ namespace FaceEngine
             W /= scalar;
         }
 
-        Vector4<T> operator -() const noexcept
+        constexpr Vector4<T> operator -() const noexcept
         {
             return Vector4<T>(-X, -Y, -Z, -W);
         }
 
-        T operator [](int index) const
+        constexpr T operator [](int index) const
         {
             if (index == 0)
             {
@@ -273,7 +252,7 @@ namespace FaceEngine
             }
         }
 
-        T& operator [](int index)
+        constexpr T& operator [](int index)
         {
             if (index == 0)
             {
@@ -297,22 +276,35 @@ namespace FaceEngine
             }
         }
 
-        static Vector4<T> Max(const Vector4& firstVector, const Vector4& secondVector) noexcept
+        static constexpr Vector4<T> Max(const Vector4& firstVector, const Vector4& secondVector) noexcept
         {
             return Vector4<T>(std::max(firstVector.X, secondVector.X), std::max(firstVector.Y, secondVector.Y), std::max(firstVector.Z, secondVector.Z), std::max(firstVector.W, secondVector.W));
         }
 
-        static Vector4<T> Min(const Vector4& firstVector, const Vector4& secondVector) noexcept
+        static constexpr Vector4<T> Min(const Vector4& firstVector, const Vector4& secondVector) noexcept
         {
             return Vector4<T>(std::min(firstVector.X, secondVector.X), std::min(firstVector.Y, secondVector.Y), std::min(firstVector.Z, secondVector.Z), std::min(firstVector.W, secondVector.W));
         }
 
-        static Vector4<T> Lerp(const Vector4& firstVector, const Vector4& secondVector, const float t) noexcept
+        static constexpr Vector4<T> Lerp(const Vector4& firstVector, const Vector4& secondVector, const float t) noexcept
         {
             return Vector4<T>(firstVector.X + (secondVector.X - firstVector.X) * t, firstVector.Y + (secondVector.Y - firstVector.Y) * t, firstVector.Z + (secondVector.Z - firstVector.Z) * t, firstVector.W + (secondVector.W - firstVector.W) * t);
         }
 
-        const std::vector<float> ToArray() const noexcept override
+        /**
+         * @brief Returns a pointer to the four contiguous components, X, Y, Z then W, without copying them.
+         */
+        constexpr T* Data() noexcept
+        {
+            return &X;
+        }
+
+        constexpr const T* Data() const noexcept
+        {
+            return &X;
+        }
+
+        const std::vector<float> ToArray() const noexcept
         {
             return {(float)X, (float)Y, (float)Z, (float)W};
         }
@@ -322,49 +314,51 @@ namespace FaceEngine
 }
 
 template <typename T>
-const FaceEngine::Vector4<T> FaceEngine::Vector4<T>::Zero(0, 0, 0, 0);
+constexpr FaceEngine::Vector4<T> FaceEngine::Vector4<T>::Zero(0, 0, 0, 0);
 
 template <typename T>
-const FaceEngine::Vector4<T> FaceEngine::Vector4<T>::One(1, 1, 1, 1);
+constexpr FaceEngine::Vector4<T> FaceEngine::Vector4<T>::One(1, 1, 1, 1);
 
 template <typename T>
-const FaceEngine::Vector4<T> FaceEngine::Vector4<T>::UnitX(1, 0, 0, 0);
+constexpr FaceEngine::Vector4<T> FaceEngine::Vector4<T>::UnitX(1, 0, 0, 0);
 
 template <typename T>
-const FaceEngine::Vector4<T> FaceEngine::Vector4<T>::UnitY(0, 1, 0, 0);
+constexpr FaceEngine::Vector4<T> FaceEngine::Vector4<T>::UnitY(0, 1, 0, 0);
 
 template <typename T>
-const FaceEngine::Vector4<T> FaceEngine::Vector4<T>::UnitZ(0, 0, 1, 0);
+constexpr FaceEngine::Vector4<T> FaceEngine::Vector4<T>::UnitZ(0, 0, 1, 0);
 
 template <typename T>
-const FaceEngine::Vector4<T> FaceEngine::Vector4<T>::UnitW(0, 0, 0, 1);
+constexpr FaceEngine::Vector4<T> FaceEngine::Vector4<T>::UnitW(0, 0, 0, 1);
+
+static_assert(std::is_standard_layout<FaceEngine::Vector4f>() && std::is_trivially_copyable<FaceEngine::Vector4f>() && sizeof(FaceEngine::Vector4f) == 4 * sizeof(float), "Vector4f must be a plain quadruple of floats.");
 
 template <typename T>
-FaceEngine::Vector4<T> operator +(const FaceEngine::Vector4<T>& firstVector, const FaceEngine::Vector4<T>& secondVector) noexcept
+constexpr FaceEngine::Vector4<T> operator +(const FaceEngine::Vector4<T>& firstVector, const FaceEngine::Vector4<T>& secondVector) noexcept
 {
     return FaceEngine::Vector4<T>(firstVector.X + secondVector.X, firstVector.Y + secondVector.Y, firstVector.Z + secondVector.Z, firstVector.W + secondVector.W);
 }
 
 template <typename T>
-FaceEngine::Vector4<T> operator -(const FaceEngine::Vector4<T>& firstVector, const FaceEngine::Vector4<T>& secondVector) noexcept
+constexpr FaceEngine::Vector4<T> operator -(const FaceEngine::Vector4<T>& firstVector, const FaceEngine::Vector4<T>& secondVector) noexcept
 {
     return FaceEngine::Vector4<T>(firstVector.X - secondVector.X, firstVector.Y - secondVector.Y, firstVector.Z - secondVector.Z, firstVector.W - secondVector.W);
 }
 
 template <typename T>
-FaceEngine::Vector4<T> operator *(const FaceEngine::Vector4<T>& vector, const float scalar) noexcept
+constexpr FaceEngine::Vector4<T> operator *(const FaceEngine::Vector4<T>& vector, const float scalar) noexcept
 {
     return FaceEngine::Vector4<T>(vector.X * scalar, vector.Y * scalar, vector.Z * scalar, vector.W * scalar);
 }
 
 template <typename T>
-FaceEngine::Vector4<T> operator *(const FaceEngine::Vector4<T>& firstVector, const FaceEngine::Vector4<T>& secondVector) noexcept
+constexpr FaceEngine::Vector4<T> operator *(const FaceEngine::Vector4<T>& firstVector, const FaceEngine::Vector4<T>& secondVector) noexcept
 {
     return FaceEngine::Vector4<T>(firstVector.X * secondVector.X, firstVector.Y * secondVector.Y, firstVector.Z * secondVector.Z, firstVector.W * secondVector.W);
 }
 
 template <typename T>
-FaceEngine::Vector4<T> operator /(const FaceEngine::Vector4<T>& vector, const float& scalar)
+constexpr FaceEngine::Vector4<T> operator /(const FaceEngine::Vector4<T>& vector, const float& scalar)
 {
     if (scalar == 0)
     {
@@ -375,13 +369,13 @@ FaceEngine::Vector4<T> operator /(const FaceEngine::Vector4<T>& vector, const fl
 }
 
 template <typename T>
-bool operator ==(const FaceEngine::Vector4<T>& firstVector, const FaceEngine::Vector4<T>& secondVector) noexcept
+constexpr bool operator ==(const FaceEngine::Vector4<T>& firstVector, const FaceEngine::Vector4<T>& secondVector) noexcept
 {
     return firstVector.X == secondVector.X && firstVector.Y == secondVector.Y && firstVector.Z == secondVector.Z && firstVector.W == secondVector.W;
 }
 
 template <typename T>
-bool operator !=(const FaceEngine::Vector4<T>& firstVector, const FaceEngine::Vector4<T>& secondVector) noexcept
+constexpr bool operator !=(const FaceEngine::Vector4<T>& firstVector, const FaceEngine::Vector4<T>& secondVector) noexcept
 {
     return firstVector.X != secondVector.X || firstVector.Y != secondVector.Y || firstVector.Z != secondVector.Z || firstVector.W != secondVector.W;
 }
@@ -0,0 +1,122 @@
+#ifndef FACEENGINE_PROFILER_H_
+#define FACEENGINE_PROFILER_H_
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+#define PROFILER_THREAD_EVENTS 65536UL
+
+#define FACE_PROFILE_CONCAT_INNER(a, b) a##b
+#define FACE_PROFILE_CONCAT(a, b) FACE_PROFILE_CONCAT_INNER(a, b)
+
+/**
+ * @brief Profiles the rest of the enclosing scope under the given name, which must be a string literal or otherwise outlive the profiler.
+ *
+ * Define FACE_ENGINE_NO_PROFILER to compile every profiling scope out entirely.
+ */
+#ifdef FACE_ENGINE_NO_PROFILER
+#define FACE_PROFILE_SCOPE(name)
+#else
+#define FACE_PROFILE_SCOPE(name) ::FaceEngine::ProfileScope FACE_PROFILE_CONCAT(__faceProfileScope, __LINE__)(name)
+#endif
+
+namespace FaceEngine
+{
+    /**
+     * @brief Records timed scopes into a per-thread ring buffer and exports them in the Chrome trace event format.
+     *
+     * Each thread writes only to its own ring buffer, which is read when exporting, so recording takes no locks.
+     * Events recorded while a ring buffer is full are dropped rather than overwriting events that haven't been exported.
+     * Recording is disabled by default; while it is disabled a profiling scope costs a single branch.
+     * Open exported traces in chrome://tracing or ui.perfetto.dev.
+     */
+    class Profiler
+    {
+    private:
+        static std::atomic_bool enabled;
+    public:
+        static inline bool IsEnabled() noexcept
+        {
+            return enabled.load(std::memory_order_relaxed);
+        }
+
+        /**
+         * @brief Starts or stops recording. Recorded events are kept until they are exported or cleared.
+         */
+        static inline void SetEnabled(bool enable) noexcept
+        {
+            enabled.store(enable, std::memory_order_relaxed);
+        }
+
+        /**
+         * @brief Returns the number of nanoseconds since the profiler's epoch.
+         */
+        static std::uint64_t Now() noexcept;
+
+        /**
+         * @brief Records a scope that ran on the current thread between two timestamps returned by Now().
+         */
+        static void Record(const char*, std::uint64_t, std::uint64_t) noexcept;
+
+        /**
+         * @brief Records an event on a named track rather than the current thread, such as the GPU track used by GPUProfiler.
+         *
+         * Only one thread should record on each track.
+         */
+        static void RecordOnTrack(const std::string&, const char*, std::uint64_t, std::uint64_t) noexcept;
+
+        /**
+         * @brief Names the current thread in exported traces.
+         */
+        static void SetThreadName(const std::string&);
+
+        /**
+         * @brief Returns the number of events dropped because a ring buffer was full, since the last export or clear.
+         */
+        static std::size_t GetDroppedCount() noexcept;
+
+        /**
+         * @brief Discards every recorded event.
+         */
+        static void Clear() noexcept;
+
+        /**
+         * @brief Writes every recorded event to a Chrome trace JSON file and discards them.
+         *
+         * An exception will be thrown if the file can't be written.
+         * @return std::size_t The number of events written.
+         */
+        static std::size_t WriteChromeTrace(const std::string&);
+    };
+
+    /**
+     * @brief Records the lifetime of the object as a profiling event. Use FACE_PROFILE_SCOPE rather than constructing this directly.
+     */
+    class ProfileScope
+    {
+    private:
+        const char* name;
+        std::uint64_t start;
+    public:
+        inline ProfileScope(const char* n) noexcept
+        {
+            name = Profiler::IsEnabled() ? n : nullptr;
+            start = name != nullptr ? Profiler::Now() : 0;
+        }
+
+        inline ~ProfileScope()
+        {
+            if (name != nullptr)
+            {
+                Profiler::Record(name, start, Profiler::Now());
+            }
+        }
+
+        ProfileScope(const ProfileScope&) = delete;
+        ProfileScope& operator=(const ProfileScope&) = delete;
+    };
+}
+
+#endif
\ No newline at end of file
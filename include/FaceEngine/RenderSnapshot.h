@@ -0,0 +1,74 @@
+#ifndef FACEENGINE_RENDERSNAPSHOT_H_
+#define FACEENGINE_RENDERSNAPSHOT_H_
+
+#include <array>
+
+namespace FaceEngine
+{
+    /**
+     * @brief The type-independent part of a RenderSnapshot, which lets Game flip snapshots without knowing their contents.
+     */
+    class RenderSnapshotBase
+    {
+        friend class Game;
+    protected:
+        unsigned int readIndex = 0;
+        bool published = false;
+
+        /**
+         * @brief Makes the last published buffer readable and gives the other buffer to the writer. Called by Game while Update() isn't running.
+         */
+        inline void Flip() noexcept
+        {
+            if (published)
+            {
+                readIndex ^= 1;
+                published = false;
+            }
+        }
+    public:
+        virtual ~RenderSnapshotBase() = default;
+    };
+
+    /**
+     * @brief Double-buffered state handed from Update() to Draw().
+     *
+     * Update() fills the buffer returned by Write() and calls Publish() once it is complete. Draw() reads the last published state with Read(),
+     * which doesn't change while Draw() is running, even when Update() runs for the next frame at the same time in pipelined mode.
+     * The snapshot must be registered with Game::AddRenderSnapshot so it's flipped between frames.
+     *
+     * Write() returns the buffer that was published two flips ago, so it should be rebuilt entirely rather than modified.
+     */
+    template <typename T>
+    class RenderSnapshot : public RenderSnapshotBase
+    {
+    private:
+        std::array<T, 2> buffers;
+    public:
+        /**
+         * @brief Returns the buffer being filled by Update(). Only Update() should call this.
+         */
+        inline T& Write() noexcept
+        {
+            return buffers[readIndex ^ 1];
+        }
+
+        /**
+         * @brief Marks the buffer returned by Write() as complete, so Draw() will read it after the next flip.
+         */
+        inline void Publish() noexcept
+        {
+            published = true;
+        }
+
+        /**
+         * @brief Returns the last published state. Only Draw() should call this.
+         */
+        inline const T& Read() const noexcept
+        {
+            return buffers[readIndex];
+        }
+    };
+}
+
+#endif
\ No newline at end of file
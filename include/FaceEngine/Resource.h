@@ -1,8 +1,21 @@
 #ifndef FACEENGINE_RESOURCE_H_
 #define FACEENGINE_RESOURCE_H_
 
+#include <cstddef>
+#include <cstdint>
+
 namespace FaceEngine
 {
+    /**
+     * @brief A generational handle to a resource tracked by a ResourceManager.
+     * 
+     * The low 20 bits are the index of the resource's slot and the high 12 bits are the generation of the slot.
+     * A handle becomes stale once its resource is disposed or untracked, even if the slot is reused.
+     */
+    typedef std::uint32_t ResourceHandle;
+
+    constexpr ResourceHandle NullResourceHandle = 0;
+
     /**
      * @brief A class representing a Face Engine resource.
      * 
@@ -16,7 +29,20 @@ namespace FaceEngine
      */
     class Resource
     {
+        friend class ResourceManager;
+    private:
+        ResourceHandle resourceHandle = NullResourceHandle;
     public:
+        virtual ~Resource() = default;
+
+        /**
+         * @brief Returns the handle of this resource, or NullResourceHandle if it isn't tracked by a ResourceManager.
+         */
+        inline ResourceHandle GetResourceHandle() const noexcept
+        {
+            return resourceHandle;
+        }
+
         /**
          * @brief Returns a boolean value indicating whether this resource has been disposed.
          * 
@@ -37,6 +63,22 @@ namespace FaceEngine
          * This function must not throw an exception.
          */
         virtual void Dispose() noexcept;
+
+        /**
+         * @brief Returns the number of bytes of video memory used by this resource.
+         * 
+         * Resources that don't hold GPU objects use zero.
+         * This function must not throw an exception.
+         */
+        virtual std::size_t GetGPUMemorySize() const noexcept;
+
+        /**
+         * @brief Returns the number of bytes of system memory used by this resource, including the object itself.
+         * 
+         * This is used for resource reports, so an estimate is fine. Resources that don't report their memory use return zero.
+         * This function must not throw an exception.
+         */
+        virtual std::size_t GetCPUMemorySize() const noexcept;
     };
 }
 
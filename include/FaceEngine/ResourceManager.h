@@ -1,28 +1,252 @@
 #ifndef FACEENGINE_RESOURCEMANAGER_H_
 #define FACEENGINE_RESOURCEMANAGER_H_
 
-#include <set>
+#include <chrono>
+#include <deque>
+#include <string>
+#include <vector>
 #include <cstdint>
 
+#include "FaceEngine/OGL.h"
 #include "FaceEngine/Resource.h"
+#include "FaceEngine/GPUMemoryTracker.h"
+#include "FaceEngine/ResourceReport.h"
 
 namespace FaceEngine
 {
+    /**
+     * @brief Tracks resources in a slot map, giving each one a generational ResourceHandle.
+     * 
+     * Tracking, untracking, disposing and handle lookups are constant time, and tracked resources are stored contiguously.
+     * Freed slots are reused with a new generation, so handles to disposed resources are detected as stale rather than resolving to another resource.
+     */
     class ResourceManager
     {
     private:
-        std::set<Resource*> resources;
+        struct Slot
+        {
+            std::uint32_t Generation;
+            // index into resources while the slot is in use, otherwise the next free slot
+            std::uint32_t Index;
+        };
+
+        struct ResourceInfo
+        {
+            std::string Tag;
+            std::uint64_t Serial;
+            std::uint64_t Frame;
+            std::chrono::steady_clock::time_point Created;
+        };
+
+        struct DeferredFrame
+        {
+            std::vector<Resource*> Resources;
+            GLsync Fence;
+            std::uint64_t Frame;
+        };
+
+        std::vector<Slot> slots;
+        std::vector<Resource*> resources;
+        // parallel to resources
+        std::vector<ResourceInfo> infos;
+        std::uint32_t freeSlot;
         bool disposingAll;
+        GPUMemoryTracker gpuMemory;
+
+        std::vector<Resource*> deferred;
+        std::deque<DeferredFrame> deferredFrames;
+        std::uint32_t disposeLatency;
+        bool batchingDeletes;
+        std::vector<GLuint> textureDeletes;
+        std::vector<GLuint> bufferDeletes;
+
+        std::string creationTag;
+        std::uint64_t nextSerial;
+        std::uint64_t leakBaseline;
+        bool leakReporting;
+        std::string reportPath;
+        std::uint32_t reportInterval;
+        ResourceReportFormat reportFormat;
+
+        bool IsTracked(const Resource*) const noexcept;
+        void Remove(Resource*) noexcept;
+        void ReleaseFrame(DeferredFrame&) noexcept;
+        void FlushDeletes() noexcept;
+        ResourceReport CreateReport(std::uint64_t) const;
+        void DumpReport() const;
     public:
+        static constexpr std::uint32_t IndexBits = 20;
+        static constexpr std::uint32_t MaxResources = 1U << IndexBits;
+
         inline ResourceManager()
         {
+            freeSlot = MaxResources;
             disposingAll = false;
+            disposeLatency = 2;
+            batchingDeletes = false;
+            nextSerial = 0;
+            leakBaseline = 0;
+            reportInterval = 0;
+            reportFormat = ResourceReportText;
+        #ifdef NDEBUG
+            leakReporting = false;
+        #else
+            leakReporting = true;
+        #endif
         }
 
         bool TrackResource(Resource*);
         bool UntrackResource(Resource*);
         bool DisposeResource(Resource*);
+
+        /**
+         * @brief Disposes the resource referred to by the handle.
+         * 
+         * @return false If the handle is stale. Debug builds throw an exception instead, as disposing a stale handle is always a bug.
+         */
+        bool DisposeResource(ResourceHandle);
+
+        /**
+         * @brief Disposes of several resources at once, such as everything loaded for a level, and frees the pool blocks they leave empty.
+         * 
+         * The OpenGL objects of the resources are deleted together rather than one at a time. Resources that aren't tracked are skipped, as are resources disposed by an earlier resource in the list, such as the regions of an atlas.
+         * 
+         * @return std::size_t The number of resources disposed.
+         */
+        std::size_t DisposeResources(const std::vector<Resource*>&);
+
+        /**
+         * @brief Untracks a resource immediately and disposes of it once the given number of frames have passed and the GPU has finished them.
+         * 
+         * This is safe to call while the resource is still referenced by queued sprite jobs or frames in flight.
+         * The handle of the resource becomes stale immediately.
+         * 
+         * @return false If the resource isn't tracked by this ResourceManager.
+         */
+        bool DeferDisposeResource(Resource*);
+
+        /**
+         * @brief Disposes of deferred resources whose frames have completed and advances the frame counter. Called by Game after every frame.
+         */
+        void EndFrame();
+
+        inline std::uint32_t GetDisposeLatency() const noexcept
+        {
+            return disposeLatency;
+        }
+
+        /**
+         * @brief Sets the number of frames deferred resources are kept alive for. The default is 2.
+         */
+        inline void SetDisposeLatency(std::uint32_t frames) noexcept
+        {
+            disposeLatency = frames;
+        }
+
+        /**
+         * @brief Deletes an OpenGL texture, batching the delete with others when resources are being disposed together.
+         */
+        void DeleteTexture(GLuint);
+
+        /**
+         * @brief Deletes an OpenGL buffer, batching the delete with others when resources are being disposed together.
+         */
+        void DeleteBuffer(GLuint);
+
         void DisposeAllResources();
+
+        /**
+         * @brief Returns the resource referred to by the handle, or nullptr if the handle is stale.
+         */
+        Resource* GetResource(ResourceHandle) const noexcept;
+
+        /**
+         * @brief Returns the resource referred to by the handle as the given type, or nullptr if the handle is stale or the resource is of another type.
+         */
+        template <typename T>
+        inline T* GetResource(ResourceHandle handle) const noexcept
+        {
+            return dynamic_cast<T*>(GetResource(handle));
+        }
+
+        inline bool IsValid(ResourceHandle handle) const noexcept
+        {
+            return GetResource(handle) != nullptr;
+        }
+
+        inline std::size_t GetResourceCount() const noexcept
+        {
+            return resources.size();
+        }
+
+        /**
+         * @brief Returns the tracked resources. The order changes as resources are untracked.
+         */
+        inline const std::vector<Resource*>& GetResources() const noexcept
+        {
+            return resources;
+        }
+
+        /**
+         * @brief Sets the tag given to resources as they are tracked, such as the name of the level or system creating them.
+         */
+        inline void SetCreationTag(const std::string& tag)
+        {
+            creationTag = tag;
+        }
+
+        inline const std::string& GetCreationTag() const noexcept
+        {
+            return creationTag;
+        }
+
+        /**
+         * @brief Replaces the tag of a tracked resource. ContentLoader tags resources with the content file they were loaded from.
+         * 
+         * @return false If the resource isn't tracked by this ResourceManager.
+         */
+        bool SetResourceTag(Resource*, const std::string&);
+
+        /**
+         * @brief Returns a report of every tracked resource with its type, memory use, tag and age, summarised by type.
+         */
+        ResourceReport GetReport() const;
+
+        /**
+         * @brief Writes a report to a file every given number of frames, replacing the previous report. An interval of zero stops the dumps.
+         */
+        void SetReportDump(const std::string&, std::uint32_t, ResourceReportFormat = ResourceReportText);
+
+        /**
+         * @brief Marks every resource tracked so far as expected to live until DisposeAllResources, excluding it from leak reports.
+         * 
+         * Game calls this after creating its own resources, before Game::Initialise.
+         */
+        inline void SetLeakBaseline() noexcept
+        {
+            leakBaseline = nextSerial;
+        }
+
+        /**
+         * @brief Returns a report of the resources tracked since the leak baseline that haven't been disposed.
+         */
+        ResourceReport GetLeakReport() const;
+
+        /**
+         * @brief Sets whether DisposeAllResources writes a leak report to the standard error stream. This is enabled by default in debug builds.
+         */
+        inline void SetLeakReporting(bool enabled) noexcept
+        {
+            leakReporting = enabled;
+        }
+
+        /**
+         * @brief Returns the tracker for the video memory used by GPU resources.
+         */
+        inline GPUMemoryTracker& GetGPUMemoryTracker() noexcept
+        {
+            return gpuMemory;
+        }
     };
 }
 
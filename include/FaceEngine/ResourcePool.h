@@ -0,0 +1,228 @@
+#ifndef FACEENGINE_RESOURCEPOOL_H_
+#define FACEENGINE_RESOURCEPOOL_H_
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <new>
+#include <vector>
+
+namespace FaceEngine
+{
+    /**
+     * @brief The type-independent part of a ResourcePool, which lets every pool be trimmed at once.
+     */
+    class ResourcePoolBase
+    {
+    private:
+        ResourcePoolBase* nextPool;
+
+        static ResourcePoolBase*& GetPools() noexcept;
+        static std::mutex& GetPoolsMutex() noexcept;
+    protected:
+        ResourcePoolBase() noexcept;
+        ~ResourcePoolBase();
+    public:
+        ResourcePoolBase(const ResourcePoolBase&) = delete;
+        ResourcePoolBase& operator=(const ResourcePoolBase&) = delete;
+
+        /**
+         * @brief Frees every block of this pool that holds no live objects.
+         *
+         * @return std::size_t The number of bytes freed.
+         */
+        virtual std::size_t Trim() noexcept = 0;
+
+        /**
+         * @brief Frees the empty blocks of every pool, such as after a level has been unloaded.
+         *
+         * @return std::size_t The number of bytes freed.
+         */
+        static std::size_t TrimAll() noexcept;
+    };
+
+    /**
+     * @brief Allocates objects of a single resource type from contiguous blocks, each holding BlockCapacity objects.
+     *
+     * Resource types route their class-specific operator new and delete through their pool, so objects created together (such as the regions of a TextureAtlas)
+     * are adjacent in memory and creating one costs a free list pop rather than a heap allocation.
+     * Allocations that aren't the size of T, which come from classes derived from T, fall back to the global heap.
+     */
+    template <typename T, std::size_t BlockCapacity = 64>
+    class ResourcePool : public ResourcePoolBase
+    {
+    private:
+        union Node
+        {
+            Node* Next;
+            alignas(T) unsigned char Storage[sizeof(T)];
+        };
+
+        struct Block
+        {
+            Node Nodes[BlockCapacity];
+            Node* FreeList;
+            std::size_t Live;
+        };
+
+        std::mutex mutex;
+        // sorted by address so the block owning an object can be found with a binary search
+        std::vector<Block*> blocks;
+        Block* current;
+        std::size_t live;
+
+        inline ResourcePool() noexcept
+        {
+            current = nullptr;
+            live = 0;
+        }
+
+        inline ~ResourcePool()
+        {
+            // objects still alive at exit are leaked rather than freed underneath their owners
+            Trim();
+        }
+
+        static inline bool Contains(const Block* block, const void* p) noexcept
+        {
+            return p >= static_cast<const void*>(block->Nodes) && p < static_cast<const void*>(block->Nodes + BlockCapacity);
+        }
+
+        inline Block* FindBlock(const void* p) const noexcept
+        {
+            auto it = std::upper_bound(blocks.begin(), blocks.end(), p, [](const void* ptr, const Block* block)
+            {
+                return std::less<const void*>()(ptr, block);
+            });
+
+            return it != blocks.begin() && Contains(*(it - 1), p) ? *(it - 1) : nullptr;
+        }
+
+        inline Block* NewBlock()
+        {
+            Block* block = new Block;
+            block->Live = 0;
+            block->FreeList = nullptr;
+
+            for (std::size_t i = BlockCapacity; i > 0; --i)
+            {
+                block->Nodes[i - 1].Next = block->FreeList;
+                block->FreeList = &block->Nodes[i - 1];
+            }
+
+            blocks.insert(std::upper_bound(blocks.begin(), blocks.end(), block, std::less<Block*>()), block);
+            return block;
+        }
+    public:
+        static inline ResourcePool& GetInstance() noexcept
+        {
+            static ResourcePool pool;
+            return pool;
+        }
+
+        static inline void* Allocate(std::size_t size)
+        {
+            if (size != sizeof(T))
+            {
+                return ::operator new(size);
+            }
+
+            ResourcePool& pool = GetInstance();
+            std::lock_guard<std::mutex> lock(pool.mutex);
+
+            if (pool.current == nullptr || pool.current->FreeList == nullptr)
+            {
+                pool.current = nullptr;
+
+                for (Block* block : pool.blocks)
+                {
+                    if (block->FreeList != nullptr)
+                    {
+                        pool.current = block;
+                        break;
+                    }
+                }
+
+                if (pool.current == nullptr)
+                {
+                    pool.current = pool.NewBlock();
+                }
+            }
+
+            Node* node = pool.current->FreeList;
+            pool.current->FreeList = node->Next;
+            ++pool.current->Live;
+            ++pool.live;
+            return node->Storage;
+        }
+
+        static inline void Free(void* p, std::size_t size) noexcept
+        {
+            if (p == nullptr)
+            {
+                return;
+            }
+            else if (size != sizeof(T))
+            {
+                ::operator delete(p);
+                return;
+            }
+
+            ResourcePool& pool = GetInstance();
+            std::lock_guard<std::mutex> lock(pool.mutex);
+            Block* block = pool.FindBlock(p);
+            Node* node = static_cast<Node*>(p);
+            node->Next = block->FreeList;
+            block->FreeList = node;
+            --block->Live;
+            --pool.live;
+        }
+
+        std::size_t Trim() noexcept override
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            std::size_t freed = 0;
+
+            blocks.erase(std::remove_if(blocks.begin(), blocks.end(), [&](Block* block)
+            {
+                if (block->Live > 0)
+                {
+                    return false;
+                }
+
+                if (block == current)
+                {
+                    current = nullptr;
+                }
+
+                delete block;
+                freed += sizeof(Block);
+                return true;
+            }), blocks.end());
+
+            return freed;
+        }
+
+        /**
+         * @brief Returns the number of objects currently allocated from this pool.
+         */
+        inline std::size_t GetLiveCount() noexcept
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            return live;
+        }
+
+        /**
+         * @brief Returns the number of objects the blocks of this pool can hold without allocating another block.
+         */
+        inline std::size_t GetCapacity() noexcept
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            return blocks.size() * BlockCapacity;
+        }
+    };
+}
+
+#endif
\ No newline at end of file
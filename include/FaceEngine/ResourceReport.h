@@ -0,0 +1,86 @@
+#ifndef FACEENGINE_RESOURCEREPORT_H_
+#define FACEENGINE_RESOURCEREPORT_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "FaceEngine/Resource.h"
+
+namespace FaceEngine
+{
+    enum ResourceReportFormat
+    {
+        ResourceReportText,
+        ResourceReportJSON
+    };
+
+    /**
+     * @brief A live resource as seen by a ResourceReport.
+     */
+    struct ResourceReportEntry
+    {
+        ResourceHandle Handle = NullResourceHandle;
+        std::string Type;
+        // where the resource was created, such as the content file it was loaded from
+        std::string Tag;
+        std::size_t CPUBytes = 0;
+        std::size_t GPUBytes = 0;
+        std::uint64_t AgeFrames = 0;
+        double AgeSeconds = 0.0;
+    };
+
+    /**
+     * @brief The live resources of a single type in a ResourceReport.
+     */
+    struct ResourceTypeSummary
+    {
+        std::string Type;
+        std::size_t Count = 0;
+        std::size_t CPUBytes = 0;
+        std::size_t GPUBytes = 0;
+        double OldestSeconds = 0.0;
+    };
+
+    /**
+     * @brief A snapshot of the resources tracked by a ResourceManager, created with ResourceManager::GetReport.
+     */
+    struct ResourceReport
+    {
+        std::uint64_t Frame = 0;
+        std::vector<ResourceReportEntry> Resources;
+        // sorted by descending memory use
+        std::vector<ResourceTypeSummary> Types;
+
+        std::size_t GetTotalCPUBytes() const noexcept;
+        std::size_t GetTotalGPUBytes() const noexcept;
+
+        /**
+         * @brief Fills Types from Resources.
+         */
+        void Summarise();
+
+        /**
+         * @brief Returns the report as human readable text: a table of types followed by every resource.
+         */
+        std::string ToText() const;
+
+        /**
+         * @brief Returns the report as a JSON object with "frame", "types" and "resources" members.
+         */
+        std::string ToJSON() const;
+
+        inline std::string ToString(ResourceReportFormat format) const
+        {
+            return format == ResourceReportJSON ? ToJSON() : ToText();
+        }
+
+        /**
+         * @brief Returns the name of the dynamic type of a resource, such as "FaceEngine::Texture2D".
+         */
+        static std::string GetTypeName(const Resource*);
+    };
+}
+
+#endif
\ No newline at end of file
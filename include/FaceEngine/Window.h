@@ -1,7 +1,10 @@
 #ifndef FACEENGINE_WINDOW_H_
 #define FACEENGINE_WINDOW_H_
 
+#include <atomic>
+#include <cstdint>
 #include <string>
+#include <vector>
 
 #include "FaceEngine/Resource.h"
 #include "FaceEngine/OGL.h"
@@ -11,21 +14,50 @@
 
 namespace FaceEngine
 {
+    struct __OffscreenContext;
+
+    /**
+     * @brief The surface a game draws to, which is either a GLFW window or an offscreen framebuffer.
+     *
+     * An offscreen window renders into a framebuffer object on a context that doesn't need a display. Where FaceEngine is built with EGL the context is surfaceless,
+     * so it works on machines without a display server or GPU, such as with Mesa's llvmpipe. Elsewhere it belongs to a hidden GLFW window.
+     */
     class Window : public Resource
     {
         friend class Game;
     private:
         Window(GraphicsDevice*);
+        Window(GraphicsDevice*, const Resolution&);
         GraphicsDevice* graphicsDevice;
         GLFWwindow* winHandle;
+        __OffscreenContext* offscreen;
         std::string title;
         Resolution resolution;
         bool fullscreen;
         bool vsync;
+        std::atomic_bool closeRequested { false };
 
         Colour clearColour;
+
+        static void SetContextHints() noexcept;
+        void CreateFramebuffer();
+        void SwapBuffers() noexcept;
+        bool ShouldClose() noexcept;
+        void RequestClose() noexcept;
     public:
-        inline bool IsDisposed() noexcept override { return winHandle == nullptr; }
+        inline bool IsDisposed() noexcept override { return winHandle == nullptr && offscreen == nullptr; }
+
+        /**
+         * @brief Returns whether the window renders into an offscreen framebuffer rather than onto the screen.
+         */
+        inline bool IsOffscreen() const noexcept { return offscreen != nullptr; }
+
+        /**
+         * @brief Returns the framebuffer the window is drawn through, which is 0 for an onscreen window.
+         *
+         * Code that draws into its own framebuffer should bind this one again afterwards.
+         */
+        GLuint GetFramebuffer() const noexcept;
 
         void Dispose() noexcept override;
 
@@ -34,7 +66,7 @@ namespace FaceEngine
         
         inline const Resolution& GetResolution() const noexcept
         {
-            if (fullscreen)
+            if (fullscreen && offscreen == nullptr)
             {
                 return graphicsDevice->GetPrimaryDisplay().GetMaxResolution();
             }
@@ -44,6 +76,9 @@ namespace FaceEngine
             }
         }
 
+        /**
+         * @brief Sets the resolution of the window. An offscreen window accepts any resolution its framebuffer can hold and discards what was drawn.
+         */
         void SetResolution(const Resolution&);
 
         inline const bool IsFullscreen() const noexcept { return fullscreen; }
@@ -55,6 +90,14 @@ namespace FaceEngine
         void CenterWindow() const noexcept;
         void Clear() noexcept;
         void Clear(const Colour&) noexcept;
+
+        /**
+         * @brief Reads back what has been drawn since the last frame was presented as tightly packed 8-bit RGBA rows, starting with the top row.
+         *
+         * Reading stalls until the GPU has finished drawing, so it is meant for tests and golden image comparisons rather than every frame.
+         * It should be called from Draw(), as the contents of an onscreen window are undefined once they have been presented.
+         */
+        std::vector<std::uint8_t> ReadPixels() const;
     };
 }
 
@@ -0,0 +1,10 @@
+#include "FaceEngine/OGL.h"
+#include "FaceEngine/Clock.h"
+
+namespace FaceEngine
+{
+    double GLFWClock::GetTime()
+    {
+        return glfwGetTime();
+    }
+}
\ No newline at end of file
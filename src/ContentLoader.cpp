@@ -2,10 +2,48 @@
 
 #include <cstring>
 #include <cstdio>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <filesystem>
+#include <memory>
+#include <vector>
 #include <zlib.h>
 
 namespace FaceEngine
 {
+    namespace
+    {
+        // adds the time until it goes out of scope to a phase of a load trace, or does nothing if the load isn't traced
+        class PhaseTimer
+        {
+        private:
+            double* phase;
+            std::chrono::steady_clock::time_point start;
+        public:
+            inline PhaseTimer(ContentLoadTrace* trace, double ContentLoadTrace::* member) noexcept
+            {
+                phase = trace != nullptr ? &(trace->*member) : nullptr;
+
+                if (phase != nullptr)
+                {
+                    start = std::chrono::steady_clock::now();
+                }
+            }
+
+            inline ~PhaseTimer()
+            {
+                if (phase != nullptr)
+                {
+                    *phase += std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+                }
+            }
+
+            PhaseTimer(const PhaseTimer&) = delete;
+            PhaseTimer& operator=(const PhaseTimer&) = delete;
+        };
+    }
+
     std::uint32_t ContentLoader::BytesToInt32(const std::array<std::uint8_t, 4>& bytes) noexcept
     {
         return (std::uint32_t)((0xFF & bytes[0]) << 24) | ((0xFF & bytes[1]) << 16) | ((0xFF & bytes[2]) << 8) | (0xFF & bytes[3]);
@@ -13,43 +51,119 @@ namespace FaceEngine
 
     bool ContentLoader::IsValidHeader(const std::uint8_t* header) const noexcept
     {
-        return std::memcmp(contentFileHeader.data(), header, 16) == 0;
+        return std::memcmp(ContentFileHeader.data(), header, 16) == 0;
     }
 
-    Texture2D* ContentLoader::LoadTexture2D(const std::string& path) const
+    bool ContentLoader::Inflate(const std::uint8_t* src, std::size_t srcSize, std::uint8_t* dst, std::size_t dstSize) noexcept
     {
-        std::FILE* fp = std::fopen(path.c_str(), "rb");
+        z_stream zStream;
+        zStream.zalloc = nullptr;
+        zStream.zfree = nullptr;
+        zStream.opaque = nullptr;
+        zStream.avail_in = srcSize;
+        zStream.next_in = (Bytef*)src;
+        zStream.avail_out = dstSize;
+        zStream.next_out = (Bytef*)dst;
+
+        if (inflateInit(&zStream) != Z_OK)
+        {
+            return false;
+        }
 
-        if (!fp)
+        int status = inflate(&zStream, Z_FINISH);
+        inflateEnd(&zStream);
+        return status == Z_STREAM_END && zStream.total_out == dstSize;
+    }
+
+    bool ContentLoader::InflateBands(const std::uint8_t* bandData, const std::uint32_t* bandOffsets, std::uint32_t bandCount,
+                                     std::uint8_t* imageData, std::size_t bandSize, std::size_t imageDataSize) const
+    {
+        std::atomic_bool failed(false);
+
+        auto inflateBands = [&](std::size_t first, std::size_t last)
         {
-            throw Exception::FromMessage("FaceEngine::ContentLoader::LoadTexture2D", "Couldn't open file for reading.");
+            for (std::size_t band = first; band < last && !failed.load(std::memory_order_relaxed); ++band)
+            {
+                std::size_t offset = band * bandSize;
+                std::size_t size = std::min(bandSize, imageDataSize - offset);
+
+                if (!Inflate(bandData + bandOffsets[band], bandOffsets[band + 1] - bandOffsets[band], imageData + offset, size))
+                {
+                    failed.store(true);
+                }
+            }
+        };
+
+        // bands are inflated on the shared workers, one band per chunk as bands are already large
+        if (jobs != nullptr)
+        {
+            jobs->ParallelFor(0, bandCount, 1, inflateBands);
+        }
+        else
+        {
+            inflateBands(0, bandCount);
         }
 
+        return !failed.load();
+    }
+
+    std::uint8_t* ContentLoader::ReadTexture2D(std::FILE* fp, std::uint32_t& width, std::uint32_t& height, std::uint32_t& levels, std::uint8_t& flags, ContentLoadTrace* trace) const
+    {
         std::uint8_t buffer[16];
+        std::uint8_t version;
 
         if (std::fread(buffer, 16, 1, fp) != 1 ||
             !IsValidHeader(buffer) ||
-            std::fread(buffer, 1, 1, fp) != 1 || buffer[0] != contentFileVersion ||
+            std::fread(&version, 1, 1, fp) != 1 || (version != ContentFileVersion1 && version != ContentFileVersion2) ||
             std::fread(buffer, 1, 1, fp) != 1 || buffer[0] != TypeTexture2D ||
             std::fread(buffer, 9, 1, fp) != 1)
         {
-            std::fclose(fp);
             throw Exception::FromMessage("FaceEngine::ContentLoader::LoadTexture2D", "Invalid content file.");
         }
         
-        std::uint32_t width = BytesToInt32({ buffer[0], buffer[1], buffer[2], buffer[3] });
-        std::uint32_t height = BytesToInt32({ buffer[4], buffer[5], buffer[6], buffer[7] });
+        width = BytesToInt32({ buffer[0], buffer[1], buffer[2], buffer[3] });
+        height = BytesToInt32({ buffer[4], buffer[5], buffer[6], buffer[7] });
         std::uint8_t compressLevel = buffer[8];
 
-        if (width < 0 || width > 2048 ||
-            height < 0 || height > 2048 ||
+        if (width < 1 || width > 2048 ||
+            height < 1 || height > 2048 ||
             compressLevel < 0 || compressLevel > Z_BEST_COMPRESSION)
         {
-            std::fclose(fp);
             throw Exception::FromMessage("FaceEngine::ContentLoader::LoadTexture2D", "Invalid content file.");
         }
 
-        std::size_t imageDataSize = width * height * 4;
+        std::uint32_t bandHeight = height;
+        levels = 1;
+        flags = 0;
+
+        if (version == ContentFileVersion2)
+        {
+            // flags followed by the number of rows in each band
+            if (std::fread(buffer, 5, 1, fp) != 1 || (buffer[0] & ~(TextureFlagMipmaps | TextureFlagPremultiplied)) != 0)
+            {
+                throw Exception::FromMessage("FaceEngine::ContentLoader::LoadTexture2D", "Invalid content file.");
+            }
+
+            flags = buffer[0];
+            bandHeight = BytesToInt32({ buffer[1], buffer[2], buffer[3], buffer[4] });
+
+            if (bandHeight < 1)
+            {
+                throw Exception::FromMessage("FaceEngine::ContentLoader::LoadTexture2D", "Invalid content file.");
+            }
+
+            if (flags & TextureFlagMipmaps)
+            {
+                if (std::fread(buffer, 1, 1, fp) != 1 || buffer[0] < 1 || buffer[0] > Texture2D::GetMaxMipLevels(width, height))
+                {
+                    throw Exception::FromMessage("FaceEngine::ContentLoader::LoadTexture2D", "Invalid content file.");
+                }
+
+                levels = buffer[0];
+            }
+        }
+
+        std::size_t imageDataSize = Texture2D::GetMipChainSize(width, height, levels);
         std::uint8_t* imageData = new std::uint8_t[imageDataSize];
 
         if (compressLevel == 0)
@@ -57,16 +171,14 @@ namespace FaceEngine
             if (std::fread(imageData, imageDataSize, 1, fp) != 1)
             {
                 delete[] imageData;
-                std::fclose(fp);
                 throw Exception::FromMessage("FaceEngine::ContentLoader::LoadTexture2D", "Invalid content file.");
             }
         }
-        else
+        else if (version == ContentFileVersion1)
         {
             if (std::fread(buffer, 1, 4, fp) != 4)
             {
                 delete[] imageData;
-                std::fclose(fp);
                 throw Exception::FromMessage("FaceEngine::ContentLoader::LoadTexture2D", "Invalid content file.");
             }
 
@@ -77,55 +189,88 @@ namespace FaceEngine
             {
                 delete[] imageData;
                 delete[] compressedImageData;
-                std::fclose(fp);
                 throw Exception::FromMessage("FaceEngine::ContentLoader::LoadTexture2D", "Invalid content file.");
             }
 
-            z_stream zStream;
-            zStream.zalloc = nullptr;
-            zStream.zfree = nullptr;
-            zStream.opaque = nullptr;
-            zStream.avail_in = compressedDataSize;
-            zStream.next_in = (Bytef*)compressedImageData;
-            zStream.avail_out = imageDataSize;
-            zStream.next_out = (Bytef*)imageData;
-            inflateInit(&zStream);
-            inflate(&zStream, Z_NO_FLUSH);
-            inflateEnd(&zStream);
+            bool inflated;
+
+            {
+                PhaseTimer timer(trace, &ContentLoadTrace::InflateSeconds);
+                inflated = Inflate(compressedImageData, compressedDataSize, imageData, imageDataSize);
+            }
+
             delete[] compressedImageData;
 
-            if (zStream.total_out != imageDataSize)
+            if (!inflated)
             {
                 delete[] imageData;
-                std::fclose(fp);
                 throw Exception::FromMessage("FaceEngine::ContentLoader::LoadTexture2D", "Invalid content file.");
             }
         }
+        else
+        {
+            // band offset table: one offset per band relative to the start of the band data, followed by the total size of the band data
+            // mip levels follow the base level in the image data and are split into bands of the same size
+            std::size_t bandSize = (std::size_t)bandHeight * width * 4;
+            std::uint32_t bandCount = (imageDataSize + bandSize - 1) / bandSize;
+            std::vector<std::uint32_t> bandOffsets(bandCount + 1);
 
-        std::fclose(fp);
-        Texture2D* result = Texture2D::CreateTexture2D(resMan, width, height, imageData);
-        delete[] imageData;
-        return result;
-    }
+            for (std::uint32_t i = 0; i <= bandCount; ++i)
+            {
+                if (std::fread(buffer, 4, 1, fp) != 1)
+                {
+                    delete[] imageData;
+                    throw Exception::FromMessage("FaceEngine::ContentLoader::LoadTexture2D", "Invalid content file.");
+                }
 
-    TextureFont* ContentLoader::LoadTextureFont(const std::string& path) const
-    {
-        std::FILE* fp = std::fopen(path.c_str(), "rb");
+                bandOffsets[i] = BytesToInt32({ buffer[0], buffer[1], buffer[2], buffer[3] });
 
-        if (!fp)
-        {
-            throw Exception::FromMessage("FaceEngine::ContentLoader::LoadTextureFont", "Couldn't open file for reading.");
+                if ((i == 0 && bandOffsets[i] != 0) || (i > 0 && bandOffsets[i] < bandOffsets[i - 1]))
+                {
+                    delete[] imageData;
+                    throw Exception::FromMessage("FaceEngine::ContentLoader::LoadTexture2D", "Invalid content file.");
+                }
+            }
+
+            std::size_t compressedDataSize = bandOffsets[bandCount];
+            std::uint8_t* compressedImageData = new std::uint8_t[compressedDataSize];
+
+            if (std::fread(compressedImageData, 1, compressedDataSize, fp) != compressedDataSize)
+            {
+                delete[] imageData;
+                delete[] compressedImageData;
+                throw Exception::FromMessage("FaceEngine::ContentLoader::LoadTexture2D", "Invalid content file.");
+            }
+
+            bool inflated;
+
+            {
+                PhaseTimer timer(trace, &ContentLoadTrace::InflateSeconds);
+                inflated = InflateBands(compressedImageData, bandOffsets.data(), bandCount, imageData, bandSize, imageDataSize);
+            }
+
+            delete[] compressedImageData;
+
+            if (!inflated)
+            {
+                delete[] imageData;
+                throw Exception::FromMessage("FaceEngine::ContentLoader::LoadTexture2D", "Invalid content file.");
+            }
         }
 
+        return imageData;
+    }
+
+    TextureFont* ContentLoader::ReadTextureFont(std::FILE* fp, ContentLoadTrace* trace) const
+    {
         std::uint8_t buffer[24];
 
         if (std::fread(buffer, 16, 1, fp) != 1 ||
             !IsValidHeader(buffer) ||
-            std::fread(buffer, 1, 1, fp) != 1 || buffer[0] != contentFileVersion ||
+            std::fread(buffer, 1, 1, fp) != 1 || buffer[0] != ContentFileVersion1 ||
             std::fread(buffer, 1, 1, fp) != 1 || buffer[0] != TypeTextureFont ||
             std::fread(buffer, 20, 1, fp) != 1)
         {
-            std::fclose(fp);
             throw Exception::FromMessage("FaceEngine::ContentLoader::LoadTextureFont", "Invalid content file.");
         }
 
@@ -135,15 +280,15 @@ namespace FaceEngine
         std::int32_t lineSpacing = BytesToInt32({ buffer[12], buffer[13], buffer[14], buffer[15] });
         std::uint32_t charCount = BytesToInt32({ buffer[16], buffer[17], buffer[18], buffer[19] });
         std::vector<FontChar> fontChars;
-        std::uint8_t* data;
-        std::uint8_t* textureData;
-        std::uint8_t* compressedData;
+        // the alpha values of each glyph, read in full before the atlas is created so its pages can be sized to the largest glyph
+        std::vector<std::unique_ptr<std::uint8_t[]>> glyphData;
+        std::vector<std::pair<std::uint32_t, std::uint32_t>> glyphSizes;
+        std::uint32_t largest = 0;
 
         for (std::uint32_t count = 0; count < charCount; ++count)
         {
             if (std::fread(buffer, 24, 1, fp) != 1)
             {
-                std::fclose(fp);
                 throw Exception::FromMessage("FaceEngine::ContentLoader::LoadTextureFont", "Invalid content file.");
             }
 
@@ -153,100 +298,495 @@ namespace FaceEngine
             std::int32_t advance = BytesToInt32({ buffer[12], buffer[13], buffer[14], buffer[15] });
             std::uint32_t width = BytesToInt32({ buffer[16], buffer[17], buffer[18], buffer[19] });
             std::uint32_t height = BytesToInt32({ buffer[20], buffer[21], buffer[22], buffer[23] });
-            Texture2D* texture;
+            fontChars.emplace_back(charCode, bearingX, bearingY, advance, nullptr);
+            glyphSizes.emplace_back(width, height);
 
             if (width == 0 || height == 0)
             {
-                fontChars.emplace_back(charCode, bearingX, bearingY, advance, nullptr);
+                glyphData.emplace_back();
                 continue;
             }
 
             std::size_t dataSize = width * height;
-            std::size_t textureDataSize = dataSize * 4;
+            std::unique_ptr<std::uint8_t[]> data(new std::uint8_t[dataSize]);
             std::uint8_t compressLevel;
 
             if (std::fread(&compressLevel, 1, 1, fp) != 1)
             {
-                std::fclose(fp);
                 throw Exception::FromMessage("FaceEngine::ContentLoader::LoadTextureFont", "Invalid content file.");
             }
 
             if (compressLevel == 0)
             {
-                data = new std::uint8_t[dataSize];
-                
-                if (std::fread(data, dataSize, 1, fp) != 1)
+                if (std::fread(data.get(), dataSize, 1, fp) != 1)
                 {
-                    delete[] data;
-                    std::fclose(fp);
                     throw Exception::FromMessage("FaceEngine::ContentLoader::LoadTextureFont", "Invalid content file.");
                 }
-
-                textureData = new std::uint8_t[textureDataSize];
-                std::size_t pos = 0;
-
-                for (std::size_t i = 0; i < textureDataSize; i += 4)
-                {
-                    textureData[i] = 0xFF;
-                    textureData[i + 1] = 0xFF;
-                    textureData[i + 2] = 0xFF;
-                    textureData[i + 3] = data[pos++];
-                }
-
-                delete[] data;
-                texture = Texture2D::CreateTexture2D(resMan, width, height, textureData);
-                delete[] textureData;
             }
             else
             {
                 if (std::fread(buffer, 4, 1, fp) != 1)
                 {
-                    std::fclose(fp);
                     throw Exception::FromMessage("FaceEngine::ContentLoader::LoadTextureFont", "Invalid content file.");
                 }
 
                 std::size_t compressedDataSize = BytesToInt32({ buffer[0], buffer[1], buffer[2], buffer[3] });
-                compressedData = new std::uint8_t[compressedDataSize];
+                std::unique_ptr<std::uint8_t[]> compressedData(new std::uint8_t[compressedDataSize]);
 
-                if (std::fread(compressedData, compressedDataSize, 1, fp) != 1)
+                if (std::fread(compressedData.get(), compressedDataSize, 1, fp) != 1)
                 {
-                    delete[] compressedData;
-                    std::fclose(fp);
                     throw Exception::FromMessage("FaceEngine::ContentLoader::LoadTextureFont", "Invalid content file.");
                 }
 
-                data = new std::uint8_t[dataSize];
                 z_stream zStream;
                 zStream.zalloc = nullptr;
                 zStream.zfree = nullptr;
                 zStream.opaque = nullptr;
                 zStream.avail_in = compressedDataSize;
-                zStream.next_in = (Bytef*)compressedData;
+                zStream.next_in = (Bytef*)compressedData.get();
                 zStream.avail_out = dataSize;
-                zStream.next_out = (Bytef*)data;
-                inflateInit(&zStream);
-                inflate(&zStream, Z_NO_FLUSH);
-                inflateEnd(&zStream);
-                delete[] compressedData;
-                textureData = new std::uint8_t[textureDataSize];
-                std::size_t pos = 0;
+                zStream.next_out = (Bytef*)data.get();
+
+                {
+                    PhaseTimer timer(trace, &ContentLoadTrace::InflateSeconds);
+                    inflateInit(&zStream);
+                    inflate(&zStream, Z_NO_FLUSH);
+                    inflateEnd(&zStream);
+                }
+            }
+
+            largest = std::max(largest, std::max(width, height));
+            glyphData.push_back(std::move(data));
+        }
+
+        // glyphs are packed into an atlas so a string can be drawn in a single batch
+        std::uint32_t pageSize = 512;
+
+        while (pageSize < largest + 1)
+        {
+            pageSize *= 2;
+        }
+
+        TextureAtlas* atlas;
+
+        {
+            PhaseTimer timer(trace, &ContentLoadTrace::UploadSeconds);
+            atlas = TextureAtlas::CreateTextureAtlas(resMan, pageSize, pageSize, 1, true);
+        }
+
+        try
+        {
+            std::vector<std::uint8_t> textureData;
+
+            for (std::size_t i = 0; i < fontChars.size(); ++i)
+            {
+                if (!glyphData[i])
+                {
+                    continue;
+                }
+
+                std::uint32_t width = glyphSizes[i].first;
+                std::uint32_t height = glyphSizes[i].second;
+                std::size_t textureDataSize = (std::size_t)width * height * 4;
+                textureData.resize(textureDataSize);
+
+                {
+                    PhaseTimer timer(trace, &ContentLoadTrace::ExpandSeconds);
+                    std::size_t pos = 0;
+
+                    // white premultiplied by the glyph's coverage, so glyph edges filter and blend without dark or bright fringes
+                    for (std::size_t j = 0; j < textureDataSize; j += 4)
+                    {
+                        const std::uint8_t coverage = glyphData[i][pos++];
+                        textureData[j] = coverage;
+                        textureData[j + 1] = coverage;
+                        textureData[j + 2] = coverage;
+                        textureData[j + 3] = coverage;
+                    }
+                }
+
+                glyphData[i].reset();
+                Texture2D* texture;
+
+                {
+                    PhaseTimer timer(trace, &ContentLoadTrace::UploadSeconds);
+                    texture = atlas->Add(width, height, textureData.data());
+                }
+
+                const FontChar& fontChar = fontChars[i];
+                fontChars[i] = FontChar(fontChar.GetCharCode(), fontChar.GetBearingX(), fontChar.GetBearingY(), fontChar.GetAdvance(), texture);
+
+                if (trace != nullptr)
+                {
+                    trace->TextureBytes += textureDataSize;
+                }
+            }
+
+            return TextureFont::CreateTextureFont(resMan, size, ascender, descender, lineSpacing, fontChars, atlas);
+        }
+        catch (const Exception&)
+        {
+            // disposes the glyphs packed so far along with the atlas
+            resMan->DisposeResource(atlas);
+            throw;
+        }
+    }
+
+    void ContentLoader::SeekPackEntry(std::FILE* fp, const std::string& entry, const std::string& origin) const
+    {
+        std::uint8_t buffer[16];
+
+        if (std::fread(buffer, 16, 1, fp) != 1 ||
+            !IsValidHeader(buffer) ||
+            std::fread(buffer, 1, 1, fp) != 1 || buffer[0] != ContentFileVersion1 ||
+            std::fread(buffer, 1, 1, fp) != 1 || buffer[0] != TypePack ||
+            std::fread(buffer, 4, 1, fp) != 1)
+        {
+            throw Exception::FromMessage(origin, "Invalid pack file.");
+        }
+
+        std::uint32_t entryCount = BytesToInt32({ buffer[0], buffer[1], buffer[2], buffer[3] });
+        std::string name;
+
+        for (std::uint32_t i = 0; i < entryCount; ++i)
+        {
+            if (std::fread(buffer, 4, 1, fp) != 1)
+            {
+                throw Exception::FromMessage(origin, "Invalid pack file.");
+            }
+
+            name.resize(BytesToInt32({ buffer[0], buffer[1], buffer[2], buffer[3] }));
+
+            if ((!name.empty() && std::fread(&name[0], name.size(), 1, fp) != 1) ||
+                std::fread(buffer, 8, 1, fp) != 1)
+            {
+                throw Exception::FromMessage(origin, "Invalid pack file.");
+            }
+
+            if (name == entry)
+            {
+                std::uint32_t offset = BytesToInt32({ buffer[0], buffer[1], buffer[2], buffer[3] });
+
+                if (std::fseek(fp, offset, SEEK_SET) != 0)
+                {
+                    throw Exception::FromMessage(origin, "Invalid pack file.");
+                }
+
+                return;
+            }
+        }
+
+        throw Exception::FromMessage(origin, "Pack file has no entry named \"" + entry + "\".");
+    }
+
+    std::unique_ptr<std::uint8_t[]> ContentLoader::ReadTexture2D(const std::string& path, const std::string& entry, std::uint32_t& width, std::uint32_t& height, std::uint32_t& levels, std::uint8_t& flags, ContentLoadTrace* trace) const
+    {
+        std::FILE* fp = std::fopen(path.c_str(), "rb");
+
+        if (!fp)
+        {
+            throw Exception::FromMessage("FaceEngine::ContentLoader::LoadTexture2D", "Couldn't open file for reading.");
+        }
 
-                for (std::size_t i = 0; i < textureDataSize; i += 4)
+        std::uint8_t* result;
+
+        try
+        {
+            if (!entry.empty())
+            {
+                SeekPackEntry(fp, entry, "FaceEngine::ContentLoader::LoadTexture2D");
+            }
+
+            long start = std::ftell(fp);
+            result = ReadTexture2D(fp, width, height, levels, flags, trace);
+
+            if (trace != nullptr)
+            {
+                trace->FileBytes = std::ftell(fp) - start;
+                trace->TextureBytes = Texture2D::GetMipChainSize(width, height, levels);
+            }
+        }
+        catch (const Exception&)
+        {
+            std::fclose(fp);
+            throw;
+        }
+
+        std::fclose(fp);
+        return std::unique_ptr<std::uint8_t[]>(result);
+    }
+
+    Texture2D* ContentLoader::CreateContentTexture2D(const std::string& path, const std::string& entry, const TextureOptions& options, ContentLoadTrace* trace) const
+    {
+        std::uint32_t width, height, levels;
+        std::uint8_t flags;
+        std::unique_ptr<std::uint8_t[]> imageData = ReadTexture2D(path, entry, width, height, levels, flags, trace);
+        Texture2D* result;
+
+        {
+            PhaseTimer timer(trace, &ContentLoadTrace::UploadSeconds);
+            result = Texture2D::CreateTexture2D(resMan, width, height, imageData.get(), options, levels);
+        }
+
+        result->premultiplied = flags & TextureFlagPremultiplied;
+
+        // content textures can be evicted from video memory as they can be read back from their content file
+        result->reloader = [this, path, entry, width, height, levels, flags]()
+        {
+            std::uint32_t w, h, l;
+            std::uint8_t f;
+            std::unique_ptr<std::uint8_t[]> data = ReadTexture2D(path, entry, w, h, l, f, nullptr);
+
+            if (w != width || h != height || l != levels || f != flags)
+            {
+                throw Exception::FromMessage("FaceEngine::Texture2D::Use", "Content file changed since the texture was evicted.");
+            }
+
+            return data;
+        };
+        result->SetEvictable(true);
+        resMan->SetResourceTag(result, ContentTag(path, entry));
+        return result;
+    }
+
+    Texture2D* ContentLoader::CreateAtlasTexture2D(const std::string& path, const std::string& entry, TextureAtlas* atlas, ContentLoadTrace* trace) const
+    {
+        std::uint32_t width, height, levels;
+        std::uint8_t flags;
+        std::unique_ptr<std::uint8_t[]> imageData = ReadTexture2D(path, entry, width, height, levels, flags, trace);
+        Texture2D* result;
+
+        {
+            PhaseTimer timer(trace, &ContentLoadTrace::UploadSeconds);
+            result = atlas->Add(width, height, imageData.get());
+        }
+
+        result->premultiplied = flags & TextureFlagPremultiplied;
+        resMan->SetResourceTag(result, ContentTag(path, entry));
+        return result;
+    }
+
+    TextureFont* ContentLoader::CreateContentTextureFont(const std::string& path, const std::string& entry, ContentLoadTrace* trace) const
+    {
+        std::FILE* fp = std::fopen(path.c_str(), "rb");
+
+        if (!fp)
+        {
+            throw Exception::FromMessage("FaceEngine::ContentLoader::LoadTextureFont", "Couldn't open file for reading.");
+        }
+
+        TextureFont* result;
+
+        try
+        {
+            if (!entry.empty())
+            {
+                SeekPackEntry(fp, entry, "FaceEngine::ContentLoader::LoadTextureFont");
+            }
+
+            long start = std::ftell(fp);
+            result = ReadTextureFont(fp, trace);
+
+            if (trace != nullptr)
+            {
+                trace->FileBytes = std::ftell(fp) - start;
+            }
+        }
+        catch (const Exception&)
+        {
+            std::fclose(fp);
+            throw;
+        }
+
+        std::fclose(fp);
+        resMan->SetResourceTag(result, ContentTag(path, entry));
+        return result;
+    }
+
+    template <typename F>
+    auto ContentLoader::Trace(const std::string& path, const std::string& entry, ContentFileType type, F load) const
+    {
+        if (!tracer)
+        {
+            return load(nullptr);
+        }
+
+        ContentLoadTrace trace;
+        trace.Path = path;
+        trace.Entry = entry;
+        trace.Type = type;
+
+        std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+        auto result = load(&trace);
+        trace.TotalSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+        // reading is whatever the other phases don't account for, as it is interleaved with parsing
+        trace.ReadSeconds = std::max(0.0, trace.TotalSeconds - trace.InflateSeconds - trace.ExpandSeconds - trace.UploadSeconds);
+        tracer(trace);
+        return result;
+    }
+
+    Texture2D* ContentLoader::LoadTexture2D(const std::string& path) const
+    {
+        return LoadTexture2D(path, TextureOptions());
+    }
+
+    Texture2D* ContentLoader::LoadTexture2D(const std::string& packPath, const std::string& entry) const
+    {
+        return LoadTexture2D(packPath, entry, TextureOptions());
+    }
+
+    Texture2D* ContentLoader::LoadTexture2D(const std::string& path, const TextureOptions& options) const
+    {
+        return Trace(path, std::string(), TypeTexture2D, [&](ContentLoadTrace* trace) { return CreateContentTexture2D(path, std::string(), options, trace); });
+    }
+
+    Texture2D* ContentLoader::LoadTexture2D(const std::string& packPath, const std::string& entry, const TextureOptions& options) const
+    {
+        return Trace(packPath, entry, TypeTexture2D, [&](ContentLoadTrace* trace) { return CreateContentTexture2D(packPath, entry, options, trace); });
+    }
+
+    Texture2D* ContentLoader::LoadTexture2D(const std::string& path, TextureAtlas* atlas) const
+    {
+        return Trace(path, std::string(), TypeTexture2D, [&](ContentLoadTrace* trace) { return CreateAtlasTexture2D(path, std::string(), atlas, trace); });
+    }
+
+    Texture2D* ContentLoader::LoadTexture2D(const std::string& packPath, const std::string& entry, TextureAtlas* atlas) const
+    {
+        return Trace(packPath, entry, TypeTexture2D, [&](ContentLoadTrace* trace) { return CreateAtlasTexture2D(packPath, entry, atlas, trace); });
+    }
+
+    TextureFont* ContentLoader::LoadTextureFont(const std::string& path) const
+    {
+        return Trace(path, std::string(), TypeTextureFont, [&](ContentLoadTrace* trace) { return CreateContentTextureFont(path, std::string(), trace); });
+    }
+
+    TextureFont* ContentLoader::LoadTextureFont(const std::string& packPath, const std::string& entry) const
+    {
+        return Trace(packPath, entry, TypeTextureFont, [&](ContentLoadTrace* trace) { return CreateContentTextureFont(packPath, entry, trace); });
+    }
+
+    std::string ContentLoader::ContentTag(const std::string& path, const std::string& entry)
+    {
+        return entry.empty() ? path : path + ":" + entry;
+    }
+
+    std::string ContentLoader::CacheKey(const std::string& path, const std::string& entry)
+    {
+        // pack entries are keyed by pack path and entry name, separated by a character that can't appear in a path
+        std::string key = std::filesystem::path(path).lexically_normal().string();
+
+        if (!entry.empty())
+        {
+            key += '\0';
+            key += entry;
+        }
+
+        return key;
+    }
+
+    template <typename T, typename F>
+    T* ContentLoader::Acquire(const std::string& key, const char* origin, F load)
+    {
+        auto it = cache.find(key);
+
+        if (it != cache.end())
+        {
+            Resource* cached = resMan->GetResource(it->second.Content);
+
+            if (cached == nullptr)
+            {
+                // the content was disposed through the ResourceManager directly, so it's loaded again
+                cacheKeys.erase(it->second.Content);
+                cache.erase(it);
+            }
+            else
+            {
+                T* content = dynamic_cast<T*>(cached);
+
+                if (!content)
                 {
-                    textureData[i] = 0xFF;
-                    textureData[i + 1] = 0xFF;
-                    textureData[i + 2] = 0xFF;
-                    textureData[i + 3] = data[pos++];
+                    throw Exception::FromMessage(origin, "Content has already been acquired as a different type.");
                 }
 
-                delete[] data;
-                texture = Texture2D::CreateTexture2D(resMan, width, height, textureData);
-                delete[] textureData;
+                ++it->second.References;
+                return content;
             }
+        }
+
+        T* content = load();
+        cache.emplace(key, CacheEntry { content->GetResourceHandle(), 1 });
+        cacheKeys.emplace(content->GetResourceHandle(), key);
+        return content;
+    }
+
+    Texture2D* ContentLoader::AcquireTexture2D(const std::string& path)
+    {
+        return Acquire<Texture2D>(CacheKey(path), "FaceEngine::ContentLoader::AcquireTexture2D", [&]() { return LoadTexture2D(path); });
+    }
+
+    Texture2D* ContentLoader::AcquireTexture2D(const std::string& packPath, const std::string& entry)
+    {
+        return Acquire<Texture2D>(CacheKey(packPath, entry), "FaceEngine::ContentLoader::AcquireTexture2D", [&]() { return LoadTexture2D(packPath, entry); });
+    }
+
+    TextureFont* ContentLoader::AcquireTextureFont(const std::string& path)
+    {
+        return Acquire<TextureFont>(CacheKey(path), "FaceEngine::ContentLoader::AcquireTextureFont", [&]() { return LoadTextureFont(path); });
+    }
+
+    TextureFont* ContentLoader::AcquireTextureFont(const std::string& packPath, const std::string& entry)
+    {
+        return Acquire<TextureFont>(CacheKey(packPath, entry), "FaceEngine::ContentLoader::AcquireTextureFont", [&]() { return LoadTextureFont(packPath, entry); });
+    }
+
+    bool ContentLoader::Release(Resource* r)
+    {
+        if (r == nullptr)
+        {
+            return false;
+        }
+
+        auto key = cacheKeys.find(r->GetResourceHandle());
+
+        if (key == cacheKeys.end())
+        {
+            return false;
+        }
 
-            fontChars.emplace_back(charCode, bearingX, bearingY, advance, texture);
+        auto it = cache.find(key->second);
+
+        if (resMan->GetResource(it->second.Content) != r)
+        {
+            cache.erase(it);
+            cacheKeys.erase(key);
+            return false;
+        }
+
+        if (--it->second.References == 0)
+        {
+            cache.erase(it);
+            cacheKeys.erase(key);
+            resMan->DisposeResource(r);
+        }
+
+        return true;
+    }
+
+    std::uint32_t ContentLoader::GetReferenceCount(const Resource* r) const noexcept
+    {
+        if (r == nullptr)
+        {
+            return 0;
+        }
+
+        auto key = cacheKeys.find(r->GetResourceHandle());
+
+        if (key == cacheKeys.end() || resMan->GetResource(key->first) != r)
+        {
+            return 0;
         }
 
-        return TextureFont::CreateTextureFont(resMan, size, ascender, descender, lineSpacing, fontChars);
+        return cache.at(key->second).References;
     }
 }
\ No newline at end of file
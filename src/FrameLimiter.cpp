@@ -0,0 +1,73 @@
+#include <algorithm>
+#include <cmath>
+#include <thread>
+
+#ifdef _WIN32
+#define NOMINMAX
+#include <windows.h>
+#include <timeapi.h>
+#endif
+
+#include "FaceEngine/FrameLimiter.h"
+#include "FaceEngine/Profiler.h"
+
+namespace FaceEngine
+{
+    FrameLimiter::FrameLimiter() noexcept
+    {
+        // assume a coarse scheduler until sleeps have been measured
+        overshootMean = 0.001;
+        overshootVariance = 0.0005 * 0.0005;
+        lastError = 0.0;
+
+    #ifdef _WIN32
+        // the default Windows timer resolution is 15.6ms, far too coarse to sleep within a frame
+        timeBeginPeriod(1);
+    #endif
+    }
+
+    FrameLimiter::~FrameLimiter()
+    {
+    #ifdef _WIN32
+        timeEndPeriod(1);
+    #endif
+    }
+
+    double FrameLimiter::GetSpinThreshold() const noexcept
+    {
+        // cover almost every overshoot, so the spin rather than a late wake up absorbs the scheduler's jitter
+        return overshootMean + 2.0 * std::sqrt(overshootVariance);
+    }
+
+    void FrameLimiter::Wait(double seconds)
+    {
+        typedef std::chrono::steady_clock Clock;
+
+        if (seconds <= 0.0)
+        {
+            return;
+        }
+
+        FACE_PROFILE_SCOPE("FrameLimiter::Wait");
+        Clock::time_point start = Clock::now();
+        Clock::time_point deadline = start + std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double>(seconds));
+        double sleepTime = seconds - GetSpinThreshold();
+
+        if (sleepTime >= MinSleep)
+        {
+            std::this_thread::sleep_for(std::chrono::duration<double>(sleepTime));
+
+            double overshoot = std::chrono::duration<double>(Clock::now() - start).count() - sleepTime;
+            double difference = overshoot - overshootMean;
+            overshootMean += Smoothing * difference;
+            overshootVariance = (1.0 - Smoothing) * (overshootVariance + Smoothing * difference * difference);
+        }
+
+        while (Clock::now() < deadline)
+        {
+            std::this_thread::yield();
+        }
+
+        lastError = std::chrono::duration<double>(Clock::now() - deadline).count();
+    }
+}
\ No newline at end of file
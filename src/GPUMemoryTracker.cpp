@@ -0,0 +1,125 @@
+#include "FaceEngine/GPUMemoryTracker.h"
+#include "FaceEngine/Graphics/Texture2D.h"
+
+#include <algorithm>
+
+namespace FaceEngine
+{
+    bool GPUMemoryTracker::IsLinked(const Texture2D* texture) const noexcept
+    {
+        return texture->previousUsed != nullptr || leastRecentlyUsed == texture;
+    }
+
+    void GPUMemoryTracker::Link(Texture2D* texture) noexcept
+    {
+        texture->previousUsed = mostRecentlyUsed;
+        texture->nextUsed = nullptr;
+
+        if (mostRecentlyUsed)
+        {
+            mostRecentlyUsed->nextUsed = texture;
+        }
+        else
+        {
+            leastRecentlyUsed = texture;
+        }
+
+        mostRecentlyUsed = texture;
+    }
+
+    void GPUMemoryTracker::Unlink(Texture2D* texture) noexcept
+    {
+        if (!IsLinked(texture))
+        {
+            return;
+        }
+
+        if (texture->previousUsed)
+        {
+            texture->previousUsed->nextUsed = texture->nextUsed;
+        }
+        else
+        {
+            leastRecentlyUsed = texture->nextUsed;
+        }
+
+        if (texture->nextUsed)
+        {
+            texture->nextUsed->previousUsed = texture->previousUsed;
+        }
+        else
+        {
+            mostRecentlyUsed = texture->previousUsed;
+        }
+
+        texture->previousUsed = nullptr;
+        texture->nextUsed = nullptr;
+    }
+
+    void GPUMemoryTracker::Touch(Texture2D* texture) noexcept
+    {
+        if (mostRecentlyUsed != texture)
+        {
+            Unlink(texture);
+            Link(texture);
+        }
+    }
+
+    bool GPUMemoryTracker::EvictLeastRecentlyUsed() noexcept
+    {
+        Texture2D* oldest = leastRecentlyUsed;
+
+        // textures drawn in the current frame are still needed, and every texture after the oldest was drawn more recently
+        if (!oldest || oldest->lastUsed >= frame)
+        {
+            return false;
+        }
+
+        Unlink(oldest);
+        oldest->Evict();
+        return true;
+    }
+
+    void GPUMemoryTracker::Allocate(GPUMemoryCategory category, std::size_t size)
+    {
+        std::size_t target = budget > 0 ? budget : limit;
+
+        if (evictionEnabled && target > 0)
+        {
+            while (GetTotalUsage() + size > target && EvictLeastRecentlyUsed());
+        }
+
+        if (limit > 0 && GetTotalUsage() + size > limit)
+        {
+            throw Exception::FromMessage("FaceEngine::GPUMemoryTracker::Allocate", "GPU memory limit exceeded.");
+        }
+
+        usage[category] += size;
+    }
+
+    void GPUMemoryTracker::Free(GPUMemoryCategory category, std::size_t size) noexcept
+    {
+        usage[category] -= std::min(size, usage[category]);
+    }
+
+    std::size_t GPUMemoryTracker::GetTotalUsage() const noexcept
+    {
+        std::size_t total = 0;
+
+        for (std::size_t categoryUsage : usage)
+        {
+            total += categoryUsage;
+        }
+
+        return total;
+    }
+
+    std::size_t GPUMemoryTracker::Trim() noexcept
+    {
+        std::size_t before = GetTotalUsage();
+
+        while (budget > 0 && GetTotalUsage() > budget && EvictLeastRecentlyUsed());
+
+        return before - GetTotalUsage();
+    }
+}
\ No newline at end of file
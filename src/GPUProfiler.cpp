@@ -0,0 +1,191 @@
+#include <deque>
+#include <unordered_map>
+#include <vector>
+
+#include "FaceEngine/OGL.h"
+#include "FaceEngine/GPUProfiler.h"
+
+namespace FaceEngine
+{
+    namespace
+    {
+        struct PendingPass
+        {
+            const char* Name;
+            GLuint Query;
+            std::uint64_t Submitted;
+        };
+
+        struct PassAverage
+        {
+            double Average = 0.0;
+            bool Sampled = false;
+        };
+
+        // weight of the newest frame in the rolling averages, roughly averaging the last 20 frames
+        constexpr double Smoothing = 0.05;
+
+        std::vector<PendingPass> currentFrame;
+        std::deque<std::vector<PendingPass>> pendingFrames;
+        std::vector<GLuint> freeQueries;
+        std::unordered_map<std::string, PassAverage> averages;
+        PassAverage frameAverage;
+        std::uint32_t depth = 0;
+
+        void Accumulate(PassAverage& average, double value) noexcept
+        {
+            average.Average = average.Sampled ? average.Average + Smoothing * (value - average.Average) : value;
+            average.Sampled = true;
+        }
+
+        void RecycleFrame(std::vector<PendingPass>& frame)
+        {
+            for (const PendingPass& pass : frame)
+            {
+                freeQueries.push_back(pass.Query);
+            }
+
+            frame.clear();
+        }
+
+        bool IsFrameAvailable(const std::vector<PendingPass>& frame) noexcept
+        {
+            for (const PendingPass& pass : frame)
+            {
+                GLint available = GL_FALSE;
+                glGetQueryObjectiv(pass.Query, GL_QUERY_RESULT_AVAILABLE, &available);
+
+                if (!available)
+                {
+                    return false;
+                }
+            }
+
+            return true;
+        }
+
+        void ReadFrame(const std::vector<PendingPass>& frame)
+        {
+            std::unordered_map<std::string, double> totals;
+            double frameTotal = 0.0;
+
+            for (const PendingPass& pass : frame)
+            {
+                GLuint64 elapsed = 0;
+                glGetQueryObjectui64v(pass.Query, GL_QUERY_RESULT, &elapsed);
+                totals[pass.Name] += elapsed / 1000000.0;
+                frameTotal += elapsed / 1000000.0;
+
+                if (Profiler::IsEnabled())
+                {
+                    Profiler::RecordOnTrack("GPU", pass.Name, pass.Submitted, pass.Submitted + elapsed);
+                }
+            }
+
+            for (auto& total : totals)
+            {
+                Accumulate(averages[total.first], total.second);
+            }
+
+            Accumulate(frameAverage, frameTotal);
+        }
+    }
+
+    std::atomic_bool GPUProfiler::enabled(false);
+
+    void GPUProfiler::BeginPass(const char* name)
+    {
+        if (depth++ > 0)
+        {
+            return;
+        }
+
+        GLuint query;
+
+        if (freeQueries.empty())
+        {
+            glGenQueries(1, &query);
+        }
+        else
+        {
+            query = freeQueries.back();
+            freeQueries.pop_back();
+        }
+
+        glBeginQuery(GL_TIME_ELAPSED, query);
+        currentFrame.push_back(PendingPass { name, query, Profiler::Now() });
+    }
+
+    void GPUProfiler::EndPass()
+    {
+        if (depth > 0 && --depth == 0)
+        {
+            glEndQuery(GL_TIME_ELAPSED);
+        }
+    }
+
+    void GPUProfiler::NextFrame()
+    {
+        if (!currentFrame.empty())
+        {
+            pendingFrames.push_back(std::move(currentFrame));
+            currentFrame.clear();
+        }
+
+        // frames finish in order, so stop at the first one the GPU hasn't finished
+        while (!pendingFrames.empty() && IsFrameAvailable(pendingFrames.front()))
+        {
+            ReadFrame(pendingFrames.front());
+            RecycleFrame(pendingFrames.front());
+            pendingFrames.pop_front();
+        }
+
+        // results the GPU takes too long to produce are dropped rather than waited for
+        while (pendingFrames.size() > GPU_PROFILER_MAX_PENDING_FRAMES)
+        {
+            for (const PendingPass& pass : pendingFrames.front())
+            {
+                glDeleteQueries(1, &pass.Query);
+            }
+
+            pendingFrames.pop_front();
+        }
+    }
+
+    double GPUProfiler::GetAverage(const std::string& name)
+    {
+        auto average = averages.find(name);
+        return average == averages.end() ? 0.0 : average->second.Average;
+    }
+
+    double GPUProfiler::GetFrameAverage() noexcept
+    {
+        return frameAverage.Average;
+    }
+
+    void GPUProfiler::Release()
+    {
+        if (depth > 0)
+        {
+            glEndQuery(GL_TIME_ELAPSED);
+            depth = 0;
+        }
+
+        for (std::vector<PendingPass>& frame : pendingFrames)
+        {
+            RecycleFrame(frame);
+        }
+
+        RecycleFrame(currentFrame);
+        pendingFrames.clear();
+
+        if (!freeQueries.empty())
+        {
+            glDeleteQueries(freeQueries.size(), freeQueries.data());
+            freeQueries.clear();
+        }
+
+        averages.clear();
+        frameAverage = PassAverage();
+    }
+}
\ No newline at end of file
@@ -1,8 +1,113 @@
+#include <algorithm>
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+
 #include "FaceEngine/OGL.h"
 #include "FaceEngine/Game.h"
+#include "FaceEngine/FrameLimiter.h"
+#include "FaceEngine/Profiler.h"
+#include "FaceEngine/GPUProfiler.h"
 
 namespace FaceEngine
 {
+    namespace
+    {
+        // runs the updates of pipelined mode, one step per frame
+        class SimulationThread
+        {
+        private:
+            std::thread thread;
+            std::mutex mutex;
+            std::condition_variable condition;
+            std::function<void()> step;
+            std::exception_ptr error;
+            bool pending = false;
+            bool stopping = false;
+
+            void Run()
+            {
+                Profiler::SetThreadName("Simulation");
+                std::unique_lock<std::mutex> lock(mutex);
+
+                while (true)
+                {
+                    condition.wait(lock, [this]() { return pending || stopping; });
+
+                    if (!pending)
+                    {
+                        return;
+                    }
+
+                    lock.unlock();
+
+                    try
+                    {
+                        step();
+                    }
+                    catch (...)
+                    {
+                        error = std::current_exception();
+                    }
+
+                    lock.lock();
+                    pending = false;
+                    condition.notify_all();
+                }
+            }
+        public:
+            inline SimulationThread(bool enabled)
+            {
+                if (enabled)
+                {
+                    thread = std::thread(&SimulationThread::Run, this);
+                }
+            }
+
+            inline ~SimulationThread()
+            {
+                if (thread.joinable())
+                {
+                    {
+                        std::lock_guard<std::mutex> lock(mutex);
+                        stopping = true;
+                    }
+
+                    condition.notify_all();
+                    thread.join();
+                }
+            }
+
+            inline void Start(std::function<void()> s)
+            {
+                {
+                    std::lock_guard<std::mutex> lock(mutex);
+                    step = std::move(s);
+                    pending = true;
+                }
+
+                condition.notify_all();
+            }
+
+            // waits for the current step and rethrows anything it threw on this thread
+            inline void Wait()
+            {
+                std::unique_lock<std::mutex> lock(mutex);
+                condition.wait(lock, [this]() { return !pending; });
+
+                if (error)
+                {
+                    std::exception_ptr e = error;
+                    error = nullptr;
+                    std::rethrow_exception(e);
+                }
+            }
+        };
+    }
+
     std::atomic_bool Game::GameRunning(false);
 
     void Game::Initialise() { }
@@ -10,70 +115,165 @@ namespace FaceEngine
     void Game::Update() { }
     void Game::Draw() { }
 
-    void Game::Run()
+    void Game::PollInput(bool rollOver)
     {
-        bool running = false;
+        FACE_PROFILE_SCOPE("Input");
 
-        if (!GameRunning.compare_exchange_strong(running, true))
+        // rolling over makes the current key state the previous one and clears typed characters, so it must only happen once an update has seen them
+        if (rollOver)
         {
-            throw Exception::FromMessage("FaceEngine::Game::Run", "Game is already running.");
+            GameUpdatePtr->UpdateInput();
         }
-        else if (!glfwInit())
+
+        if (!WindowPtr->IsOffscreen())
         {
-            throw Exception::FromMessage("FaceEngine::Game::Run", "Couldn't initialise GLFW.");
+            glfwPollEvents();
         }
+    }
 
-        glfwDefaultWindowHints();
-        glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 3);
-        glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 3);
-        glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
-        glfwWindowHint(GLFW_VISIBLE, GLFW_FALSE);
-        glfwWindowHint(GLFW_RESIZABLE, GLFW_FALSE);
-        glfwWindowHint(GLFW_FOCUS_ON_SHOW, GLFW_TRUE);
-    #ifdef __APPLE__
-        #warning imagine being an apple user
-        glfwWindowHint(GLFW_OPENGL_FORWARD_COMPAT, GL_TRUE);
-    #endif
+    void Game::RunUpdate()
+    {
+        FACE_PROFILE_SCOPE("Update");
+        Update();
+    }
 
-        GraphicsDevicePtr = new GraphicsDevice;
+    void Game::RunDraw()
+    {
+        FACE_PROFILE_SCOPE("Draw");
+        Draw();
+    }
 
-        try
+    void Game::Present()
+    {
         {
-            WindowPtr = new Window(GraphicsDevicePtr);
+            FACE_PROFILE_SCOPE("SwapBuffers");
+            WindowPtr->SwapBuffers();
         }
-        catch (const Exception& e)
+
+        GPUProfiler::NextFrame();
+        ResourceManagerPtr->EndFrame();
+    }
+
+    void Game::FlipSnapshots() noexcept
+    {
+        for (RenderSnapshotBase* snapshot : snapshots)
         {
-            delete GraphicsDevicePtr;
-            glfwTerminate();
-            throw e;
+            snapshot->Flip();
         }
+    }
 
-        GLFWwindow* winHandle = WindowPtr->winHandle;
-        glfwMakeContextCurrent(winHandle);
+    void Game::TrackJobSystem()
+    {
+        if (jobSystem != nullptr)
+        {
+            JobSystemPtr = jobSystem;
+        }
+        else
+        {
+            ResourceManagerPtr->TrackResource(JobSystemPtr = new JobSystem);
+        }
+    }
 
-        if (!gladLoadGLLoader((GLADloadproc)glfwGetProcAddress))
+    void Game::Run()
+    {
+        if (Headless)
         {
-            delete WindowPtr;
-            delete GraphicsDevicePtr;
-            glfwTerminate();
-            throw Exception::FromMessage("FaceEngine::Game::Run", "Could not load OpenGL functions.");
+            RunHeadless();
+            return;
+        }
+
+        bool running = false;
+
+        if (!GameRunning.compare_exchange_strong(running, true))
+        {
+            throw Exception::FromMessage("FaceEngine::Game::Run", "Game is already running.");
+        }
+
+        if (Offscreen)
+        {
+            // the offscreen window creates its own context, which doesn't need GLFW
+            GraphicsDevicePtr = new GraphicsDevice(OffscreenResolution);
+
+            try
+            {
+                WindowPtr = new Window(GraphicsDevicePtr, OffscreenResolution);
+            }
+            catch (const Exception& e)
+            {
+                delete GraphicsDevicePtr;
+                GameRunning.store(false);
+                throw e;
+            }
         }
+        else
+        {
+            if (!glfwInit())
+            {
+                GameRunning.store(false);
+                throw Exception::FromMessage("FaceEngine::Game::Run", "Couldn't initialise GLFW.");
+            }
 
+            Window::SetContextHints();
+            GraphicsDevicePtr = new GraphicsDevice;
+
+            try
+            {
+                WindowPtr = new Window(GraphicsDevicePtr);
+            }
+            catch (const Exception& e)
+            {
+                delete GraphicsDevicePtr;
+                glfwTerminate();
+                GameRunning.store(false);
+                throw e;
+            }
+
+            glfwMakeContextCurrent(WindowPtr->winHandle);
+
+            if (!gladLoadGLLoader((GLADloadproc)glfwGetProcAddress))
+            {
+                WindowPtr->Dispose();
+                delete WindowPtr;
+                delete GraphicsDevicePtr;
+                glfwTerminate();
+                GameRunning.store(false);
+                throw Exception::FromMessage("FaceEngine::Game::Run", "Could not load OpenGL functions.");
+            }
+        }
+
+        GLFWwindow* winHandle = WindowPtr->winHandle;
         glViewport(0, 0, WindowPtr->resolution.GetWidth(), WindowPtr->resolution.GetHeight());
         ResourceManagerPtr = new ResourceManager;
         ResourceManagerPtr->TrackResource(WindowPtr);
         ResourceManagerPtr->TrackResource(GraphicsDevicePtr);
-        ResourceManagerPtr->TrackResource(ContentLoaderPtr = new ContentLoader(ResourceManagerPtr));
+        TrackJobSystem();
+        ResourceManagerPtr->TrackResource(ContentLoaderPtr = new ContentLoader(ResourceManagerPtr, JobSystemPtr));
         ResourceManagerPtr->TrackResource(GameUpdatePtr = new GameUpdate(winHandle));
         ResourceManagerPtr->TrackResource(GameDrawPtr = new GameDraw);
         ResourceManagerPtr->TrackResource(AudioDevicePtr = new AudioDevice);
+        ResourceManagerPtr->SetLeakBaseline();
+
+        // the clock can only be created once GLFW is initialised, which offscreen games don't do
+        std::unique_ptr<Clock> defaultClock;
+
+        if (clock == nullptr)
+        {
+            defaultClock.reset(Offscreen ? (Clock*)new SteadyClock : new GLFWClock);
+            clock = defaultClock.get();
+        }
 
         // initialise
+        Profiler::SetThreadName("Main");
         Initialise();
-        glfwShowWindow(winHandle);
+
+        if (winHandle != nullptr)
+        {
+            glfwShowWindow(winHandle);
+        }
+
         glClearColor(0.0f, 0.0f, 0.0f, 1.0f);
 
-        double now = glfwGetTime();
+        double now = clock->GetTime();
 
         // UPS/FPS stuff
         std::uint32_t updates = 0, frames = 0;
@@ -85,14 +285,67 @@ namespace FaceEngine
         double lastDraw = now;
         double accumulator = 0.0;
         double frameTime;
-        double refreshRate = (double)glfwGetVideoMode(glfwGetPrimaryMonitor())->refreshRate;
+        double refreshRate = winHandle != nullptr ? (double)glfwGetVideoMode(glfwGetPrimaryMonitor())->refreshRate : 60.0;
         float dt;
+        SimulationThread simulation(Pipelined);
+        FrameLimiter limiter;
+        bool inputSeen = true;
 
-        while (!glfwWindowShouldClose(winHandle))
+        while (!WindowPtr->ShouldClose())
         {
-            now = glfwGetTime();
+            now = clock->GetTime();
 
-            if (PreferredUpdates > 0.0)
+            if (Pipelined)
+            {
+                // the simulation thread is idle here, so input can be polled and the last update's snapshots handed to Draw()
+                std::uint32_t steps = 1;
+                double stepDelta;
+
+                if (PreferredUpdates > 0.0)
+                {
+                    dt = 1.0 / PreferredUpdates;
+                    stepDelta = dt;
+                    frameTime = now - lastUpdate;
+
+                    if (frameTime > 0.25) { frameTime = 0.25; }
+
+                    lastUpdate = now;
+                    accumulator += frameTime;
+
+                    for (steps = 0; accumulator >= dt; ++steps)
+                    {
+                        accumulator -= dt;
+                    }
+                }
+                else
+                {
+                    stepDelta = now - lastUpdate;
+                    lastUpdate = now;
+                }
+
+                // events are still pumped on frames without an update so the window stays responsive, and are kept for the next update
+                PollInput(inputSeen);
+                inputSeen = steps > 0;
+                FlipSnapshots();
+
+                if (steps > 0)
+                {
+                    simulation.Start([this, steps, stepDelta]()
+                    {
+                        for (std::uint32_t i = 0; i < steps; ++i)
+                        {
+                            // input only changes between frames, so later steps mustn't see the same presses again
+                            if (i > 0) { GameUpdatePtr->UpdateInput(); }
+
+                            GameUpdatePtr->delta = stepDelta;
+                            RunUpdate();
+                        }
+                    });
+
+                    updates += steps;
+                }
+            }
+            else if (PreferredUpdates > 0.0)
             {
                 dt = 1.0 / PreferredUpdates;
                 frameTime = now - lastUpdate;
@@ -105,9 +358,8 @@ namespace FaceEngine
                 while (accumulator >= dt)
                 {
                     GameUpdatePtr->delta = dt;
-                    GameUpdatePtr->UpdateInput();
-                    glfwPollEvents();
-                    Update();
+                    PollInput(true);
+                    RunUpdate();
                     accumulator -= dt;
                     ++updates;
                 }
@@ -116,14 +368,23 @@ namespace FaceEngine
             {
                 GameUpdatePtr->delta = now - lastUpdate;
                 lastUpdate = now;
-                GameUpdatePtr->UpdateInput();
-                glfwPollEvents();
-                Update();
+                PollInput(true);
+                RunUpdate();
                 ++updates;
             }
 
+            if (!Pipelined)
+            {
+                FlipSnapshots();
+            }
+
+            {
+                FACE_PROFILE_SCOPE("MainThreadJobs");
+                JobSystemPtr->RunMainThreadJobs();
+            }
+
             // handle drawing
-            now = glfwGetTime();
+            now = clock->GetTime();
             GameDrawPtr->alpha = accumulator / dt;
 
             if (WindowPtr->vsync)
@@ -132,9 +393,9 @@ namespace FaceEngine
                 {
                     GameDrawPtr->delta = now - lastDraw;
                     lastDraw = now;
-                    Draw();
+                    RunDraw();
                     ++frames;
-                    glfwSwapBuffers(winHandle);
+                    Present();
                 }
             }
             else if (PreferredDraws > 0.0)
@@ -143,22 +404,28 @@ namespace FaceEngine
                 {
                     GameDrawPtr->delta = now - lastDraw;
                     lastDraw = now;
-                    Draw();
+                    RunDraw();
                     ++frames;
-                    glfwSwapBuffers(winHandle);
+                    Present();
                 }
             }
             else
             {
                 GameDrawPtr->delta = now - lastDraw;
                 lastDraw = now;
-                Draw();
+                RunDraw();
                 ++frames;
-                glfwSwapBuffers(winHandle);
+                Present();
+            }
+
+            // the next frame's input and snapshots can't be touched until the update for it has finished
+            {
+                FACE_PROFILE_SCOPE("WaitForUpdate");
+                simulation.Wait();
             }
 
             // UPS/FPS check
-            now = glfwGetTime();
+            now = clock->GetTime();
 
             if (now - lastUPS >= 1.0)
             {
@@ -173,20 +440,161 @@ namespace FaceEngine
                 GameDrawPtr->fps = frames;
                 frames = 0;
             }
+
+            // sleep until the next update or draw is due rather than spinning until it is
+            double nextDraw = now;
+
+            if (WindowPtr->vsync)
+            {
+                nextDraw = lastDraw + 1.0 / refreshRate;
+            }
+            else if (PreferredDraws > 0.0)
+            {
+                nextDraw = lastDraw + 1.0 / PreferredDraws;
+            }
+
+            double nextUpdate = PreferredUpdates > 0.0 ? lastUpdate + dt - accumulator : nextDraw;
+            limiter.Wait(std::min(nextDraw, nextUpdate) - now);
         }
         
         OnExit();
+        GPUProfiler::Release();
         ResourceManagerPtr->DisposeAllResources();
         delete ResourceManagerPtr;
-        glfwTerminate();
+
+        if (!Offscreen)
+        {
+            glfwTerminate();
+        }
+
+        if (defaultClock)
+        {
+            clock = nullptr;
+        }
+
         GameRunning.store(false);
     }
 
+    void Game::RunHeadless()
+    {
+        bool running = false;
+
+        if (!headlessRunning.compare_exchange_strong(running, true))
+        {
+            throw Exception::FromMessage("FaceEngine::Game::Run", "Game is already running.");
+        }
+        else if (PreferredUpdates <= 0.0)
+        {
+            // without a timestep to wait for, updates would run back to back and spin a core
+            headlessRunning.store(false);
+            throw Exception::FromMessage("FaceEngine::Game::Run", "Headless games need a fixed timestep.");
+        }
+
+        exitRequested.store(false);
+        GraphicsDevicePtr = nullptr;
+        WindowPtr = nullptr;
+        ContentLoaderPtr = nullptr;
+        GameDrawPtr = nullptr;
+        AudioDevicePtr = nullptr;
+
+        ResourceManagerPtr = new ResourceManager;
+        TrackJobSystem();
+        ResourceManagerPtr->TrackResource(GameUpdatePtr = new GameUpdate(nullptr));
+        ResourceManagerPtr->SetLeakBaseline();
+
+        std::unique_ptr<Clock> defaultClock;
+
+        if (clock == nullptr)
+        {
+            defaultClock.reset(FastForward ? (Clock*)new ManualClock : new SteadyClock);
+            clock = defaultClock.get();
+        }
+
+        ManualClock* manualClock = FastForward ? dynamic_cast<ManualClock*>(clock) : nullptr;
+        Initialise();
+
+        double now = clock->GetTime();
+        std::uint32_t updates = 0;
+        double lastUPS = now;
+        double lastUpdate = now;
+        double accumulator = 0.0;
+        double frameTime;
+        double dt = 1.0 / PreferredUpdates;
+        FrameLimiter limiter;
+
+        while (!exitRequested.load())
+        {
+            if (FastForward)
+            {
+                GameUpdatePtr->delta = dt;
+                GameUpdatePtr->UpdateInput();
+                RunUpdate();
+                ++updates;
+
+                if (manualClock != nullptr)
+                {
+                    manualClock->Advance(dt);
+                }
+            }
+            else
+            {
+                now = clock->GetTime();
+                frameTime = now - lastUpdate;
+
+                if (frameTime > 0.25) { frameTime = 0.25; }
+
+                lastUpdate = now;
+                accumulator += frameTime;
+
+                while (accumulator >= dt)
+                {
+                    GameUpdatePtr->delta = dt;
+                    GameUpdatePtr->UpdateInput();
+                    RunUpdate();
+                    accumulator -= dt;
+                    ++updates;
+                }
+
+                limiter.Wait(lastUpdate + dt - accumulator - clock->GetTime());
+            }
+
+            // a shared job system's main thread jobs are run by the game on its main thread
+            if (JobSystemPtr->IsMainThread())
+            {
+                JobSystemPtr->RunMainThreadJobs();
+            }
+
+            now = clock->GetTime();
+
+            if (now - lastUPS >= 1.0)
+            {
+                lastUPS = now;
+                GameUpdatePtr->ups = updates;
+                updates = 0;
+            }
+        }
+
+        OnExit();
+        ResourceManagerPtr->DisposeAllResources();
+        delete ResourceManagerPtr;
+
+        if (defaultClock)
+        {
+            clock = nullptr;
+        }
+
+        headlessRunning.store(false);
+    }
+
     void Game::Exit()
     {
-        if (GameRunning.load())
+        if (headlessRunning.load())
+        {
+            exitRequested.store(true);
+        }
+        else if (GameRunning.load())
         {
-            glfwSetWindowShouldClose(WindowPtr->winHandle, GLFW_TRUE);
+            WindowPtr->RequestClose();
         }
         else
         {
@@ -54,10 +54,14 @@ namespace FaceEngine
             currentMice[i] = GLFW_RELEASE;
         }
 
-        thisptr = this;
-        glfwSetKeyCallback(winHandle, &KeyCallback);
-        glfwSetMouseButtonCallback(winHandle, &MouseCallback);
-        glfwSetCursorPosCallback(winHandle, &CursorPosCallback);
+        // headless games have no window, so their input stays released
+        if (winHandle != nullptr)
+        {
+            thisptr = this;
+            glfwSetKeyCallback(winHandle, &KeyCallback);
+            glfwSetMouseButtonCallback(winHandle, &MouseCallback);
+            glfwSetCursorPosCallback(winHandle, &CursorPosCallback);
+        }
     }
 
     void GameUpdate::Dispose() noexcept
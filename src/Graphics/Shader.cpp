@@ -11,6 +11,18 @@ namespace FaceEngine
         }
     }
 
+    void Shader::SetUniform(const std::string& name, float value)
+    {
+        GLint l = glGetUniformLocation(program, name.c_str());
+
+        if (l == -1)
+        {
+            throw Exception::FromMessage("FaceEngine::Shader::SetUniform", "Invalid uniform name.");
+        }
+
+        glUniform1f(l, value);
+    }
+
     void Shader::SetUniform(const std::string& name, const Vector2f& vec2)
     {
         GLint l = glGetUniformLocation(program, name.c_str());
@@ -20,7 +32,7 @@ namespace FaceEngine
             throw Exception::FromMessage("FaceEngine::Shader::SetUniform", "Invalid uniform name.");
         }
 
-        glUniform2fv(l, 1, &vec2.ToArray()[0]);
+        glUniform2fv(l, 1, vec2.Data());
     }
 
     void Shader::SetUniform(const std::string& name, const Matrix4f& mat4)
@@ -32,7 +44,7 @@ namespace FaceEngine
             throw Exception::FromMessage("FaceEngine::Shader::SetUniform", "Invalid uniform name.");
         }
 
-        glUniformMatrix4fv(l, 1, GL_FALSE, &mat4.ToArray()[0]);
+        glUniformMatrix4fv(l, 1, GL_TRUE, mat4.Data());
     }
 
     Shader* Shader::CreateShader(ResourceManager* rm, const std::string& vertexShader, const std::string& fragmentShader)
@@ -1,14 +1,21 @@
 #include "FaceEngine/Graphics/SpriteBatcher.h"
+#include "FaceEngine/Profiler.h"
+#include "FaceEngine/GPUProfiler.h"
+
+#include <algorithm>
 
 namespace FaceEngine
 {
-    SpriteBatcher::SpriteBatcher(Window* w, ResourceManager* rm, Shader* s) noexcept
+    SpriteBatcher::SpriteBatcher(Window* w, ResourceManager* rm, Shader* s)
     {
         win = w;
         resMan = rm;
         shader = s;
         disposed = false;
         hasBegun = false;
+        shaderPremultiplies = false;
+        blendState = BlendAlpha;
+        vertexData.resize(MAX_BATCH_SPRITES * 60);
 
         glGenVertexArrays(1, &vao);
         glGenBuffers(1, &vbo);
@@ -18,15 +25,20 @@ namespace FaceEngine
         glBindBuffer(GL_ARRAY_BUFFER, vbo);
         glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, ebo);
 
-        glBufferData(GL_ARRAY_BUFFER, 240, nullptr, GL_DYNAMIC_DRAW);
-        GLuint indices[6];
-        indices[0] = 0;
-        indices[1] = 1;
-        indices[2] = 2;
-        indices[3] = 2;
-        indices[4] = 3;
-        indices[5] = 0;
-        glBufferData(GL_ELEMENT_ARRAY_BUFFER, sizeof(indices), indices, GL_STATIC_DRAW);
+        glBufferData(GL_ARRAY_BUFFER, MAX_BATCH_SPRITES * 240, nullptr, GL_STREAM_DRAW);
+        std::vector<GLuint> indices(MAX_BATCH_SPRITES * 6);
+
+        for (GLuint i = 0; i < MAX_BATCH_SPRITES; ++i)
+        {
+            indices[i * 6] = i * 4;
+            indices[i * 6 + 1] = i * 4 + 1;
+            indices[i * 6 + 2] = i * 4 + 2;
+            indices[i * 6 + 3] = i * 4 + 2;
+            indices[i * 6 + 4] = i * 4 + 3;
+            indices[i * 6 + 5] = i * 4;
+        }
+
+        glBufferData(GL_ELEMENT_ARRAY_BUFFER, indices.size() * sizeof(GLuint), indices.data(), GL_STATIC_DRAW);
         glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, 60, (void*)0);
         glEnableVertexAttribArray(0);
         glVertexAttribPointer(1, 2, GL_FLOAT, GL_FALSE, 60, (void*)(2 * sizeof(float)));
@@ -43,7 +55,20 @@ namespace FaceEngine
         glEnableVertexAttribArray(6);
     }
 
-    void SpriteBatcher::Begin()
+    void SpriteBatcher::Dispose() noexcept
+    {
+        if (!disposed)
+        {
+            resMan->GetGPUMemoryTracker().Free(GPUMemoryBuffers, GetGPUMemorySize());
+            glDeleteVertexArrays(1, &vao);
+            resMan->DeleteBuffer(vbo);
+            resMan->DeleteBuffer(ebo);
+            resMan->DisposeResource(shader);
+            disposed = true;
+        }
+    }
+
+    void SpriteBatcher::Begin(BlendState blend)
     {
         if (hasBegun)
         {
@@ -52,9 +77,10 @@ namespace FaceEngine
 
         hasBegun = true;
         transform = Matrix4f::Identity;
+        blendState = blend;
     }
 
-    void SpriteBatcher::Begin(const Vector2f& translation)
+    void SpriteBatcher::Begin(const Vector2f& translation, BlendState blend)
     {
         if (hasBegun)
         {
@@ -63,9 +89,10 @@ namespace FaceEngine
 
         hasBegun = true;
         transform = Matrix4f::CreateTranslation(translation.X, translation.Y, 0.0f);
+        blendState = blend;
     }
 
-    void SpriteBatcher::Begin(const Matrix4f& mat4)
+    void SpriteBatcher::Begin(const Matrix4f& mat4, BlendState blend)
     {
         if (hasBegun)
         {
@@ -74,10 +101,47 @@ namespace FaceEngine
 
         hasBegun = true;
         transform = mat4;
+        blendState = blend;
+    }
+
+    void SpriteBatcher::WriteVertices(float* vertices, const __BatchJob& job, bool premultiply) noexcept
+    {
+        // corners in the order top left, top right, bottom right, bottom left
+        static const float corners[4][2] = { { -0.5f, 0.5f }, { 0.5f, 0.5f }, { 0.5f, -0.5f }, { -0.5f, -0.5f } };
+        const float left = (int)job.Source.GetLeft() + job.Texture->GetSourceX();
+        const float right = (int)job.Source.GetRight() + job.Texture->GetSourceX();
+        const float top = (int)job.Source.GetTop() + job.Texture->GetSourceY();
+        const float bottom = (int)job.Source.GetBottom() + job.Texture->GetSourceY();
+        const float texCoords[4][2] = { { left, top }, { right, top }, { right, bottom }, { left, bottom } };
+        const float alpha = job._Colour.GetA();
+        const float colourScale = premultiply ? alpha : 1.0f;
+
+        for (int i = 0; i < 4; ++i)
+        {
+            float* vertex = vertices + i * 15;
+            vertex[0] = corners[i][0];
+            vertex[1] = corners[i][1];
+            vertex[2] = (int)job.Rect.Width;
+            vertex[3] = (int)job.Rect.Height;
+            vertex[4] = (int)job.Rect.X;
+            vertex[5] = (int)job.Rect.Y;
+            vertex[6] = job.Rotation;
+            vertex[7] = job.RotationOrigin.X;
+            vertex[8] = job.RotationOrigin.Y;
+            vertex[9] = texCoords[i][0];
+            vertex[10] = texCoords[i][1];
+            vertex[11] = job._Colour.GetR() * colourScale;
+            vertex[12] = job._Colour.GetG() * colourScale;
+            vertex[13] = job._Colour.GetB() * colourScale;
+            vertex[14] = alpha;
+        }
     }
 
     void SpriteBatcher::End()
     {
+        FACE_PROFILE_SCOPE("SpriteBatcher::End");
+        FACE_GPU_PROFILE_SCOPE("SpriteBatcher::End");
+
         if (!hasBegun)
         {
             throw Exception::FromMessage("FaceEngine::SpriteBatcher::Begin", "Invalid state.");
@@ -94,89 +158,83 @@ namespace FaceEngine
         glBindBuffer(GL_ARRAY_BUFFER, vbo);
         glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, ebo);
         glActiveTexture(GL_TEXTURE0);
-        glEnable(GL_BLEND);
-        glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+
+        // blending works on premultiplied colours, so textures with straight alpha are premultiplied by the shader as they're sampled
+        switch (blendState)
+        {
+            case BlendAdditive:
+                glEnable(GL_BLEND);
+                glBlendFunc(GL_ONE, GL_ONE);
+                break;
+            case BlendMultiply:
+                glEnable(GL_BLEND);
+                glBlendFunc(GL_DST_COLOR, GL_ONE_MINUS_SRC_ALPHA);
+                break;
+            case BlendOpaque:
+                glDisable(GL_BLEND);
+                break;
+            default:
+                glEnable(GL_BLEND);
+                glBlendFunc(GL_ONE, GL_ONE_MINUS_SRC_ALPHA);
+                break;
+        }
+
+        // without blending colours are written as they are, so nothing is premultiplied
+        const bool premultiply = blendState != BlendOpaque;
 
         shader->SetActive();
         const Resolution& resolution = win->GetResolution();
         shader->SetUniform("projection", Matrix4f::CreateOrthographic(resolution.GetWidth(), resolution.GetHeight(), 0.0f, 1.0f));
         shader->SetUniform("windowSize", Vector2f(resolution.GetWidth(), resolution.GetHeight()));
         shader->SetUniform("transform", transform);
-        
-        float* vertexData = new float[60];
-        vertexData[0] = -0.5f;
-        vertexData[1] = 0.5f;
-        vertexData[15] = 0.5f;
-        vertexData[16] = 0.5f;
-        vertexData[30] = 0.5f;
-        vertexData[31] = -0.5f;
-        vertexData[45] = -0.5f;
-        vertexData[46] = -0.5f;
-
-        for (const __BatchJob& job : jobs)
-        {
-            vertexData[2] = (int)job.Rect.Width;
-            vertexData[3] = (int)job.Rect.Height;
-            vertexData[4] = (int)job.Rect.X;
-            vertexData[5] = (int)job.Rect.Y;
-            vertexData[6] = job.Rotation;
-            vertexData[7] = job.RotationOrigin.X;
-            vertexData[8] = job.RotationOrigin.Y;
-            vertexData[9] = (int)job.Source.GetLeft();
-            vertexData[10] = (int)job.Source.GetTop();
-            vertexData[11] = job._Colour.GetR();
-            vertexData[12] = job._Colour.GetB();
-            vertexData[13] = job._Colour.GetG();
-            vertexData[14] = job._Colour.GetA();
-
-            vertexData[17] = (int)job.Rect.Width;
-            vertexData[18] = (int)job.Rect.Height;
-            vertexData[19] = (int)job.Rect.X;
-            vertexData[20] = (int)job.Rect.Y;
-            vertexData[21] = job.Rotation;
-            vertexData[22] = job.RotationOrigin.X;
-            vertexData[23] = job.RotationOrigin.Y;
-            vertexData[24] = (int)job.Source.GetRight();
-            vertexData[25] = (int)job.Source.GetTop();
-            vertexData[26] = job._Colour.GetR();
-            vertexData[27] = job._Colour.GetB();
-            vertexData[28] = job._Colour.GetG();
-            vertexData[29] = job._Colour.GetA();
-
-            vertexData[32] = (int)job.Rect.Width;
-            vertexData[33] = (int)job.Rect.Height;
-            vertexData[34] = (int)job.Rect.X;
-            vertexData[35] = (int)job.Rect.Y;
-            vertexData[36] = job.Rotation;
-            vertexData[37] = job.RotationOrigin.X;
-            vertexData[38] = job.RotationOrigin.Y;
-            vertexData[39] = (int)job.Source.GetRight();
-            vertexData[40] = (int)job.Source.GetBottom();
-            vertexData[41] = job._Colour.GetR();
-            vertexData[42] = job._Colour.GetB();
-            vertexData[43] = job._Colour.GetG();
-            vertexData[44] = job._Colour.GetA();
-
-            vertexData[47] = (int)job.Rect.Width;
-            vertexData[48] = (int)job.Rect.Height;
-            vertexData[49] = (int)job.Rect.X;
-            vertexData[50] = (int)job.Rect.Y;
-            vertexData[51] = job.Rotation;
-            vertexData[52] = job.RotationOrigin.X;
-            vertexData[53] = job.RotationOrigin.Y;
-            vertexData[54] = (int)job.Source.GetLeft();
-            vertexData[55] = (int)job.Source.GetBottom();
-            vertexData[56] = job._Colour.GetR();
-            vertexData[57] = job._Colour.GetB();
-            vertexData[58] = job._Colour.GetG();
-            vertexData[59] = job._Colour.GetA();
-
-            glBufferSubData(GL_ARRAY_BUFFER, 0, 240, vertexData);
-            glBindTexture(GL_TEXTURE_2D, job.Texture->GetHandle());
-            glDrawElements(GL_TRIANGLES, 6, GL_UNSIGNED_INT, 0);
-        }
-
-        delete[] vertexData;
+
+        statistics.Sprites += jobs.size();
+
+        for (std::size_t first = 0; first < jobs.size(); first += MAX_BATCH_SPRITES)
+        {
+            const std::size_t count = std::min(jobs.size() - first, MAX_BATCH_SPRITES);
+
+            for (std::size_t i = 0; i < count; ++i)
+            {
+                WriteVertices(&vertexData[i * 60], jobs[first + i], premultiply);
+            }
+
+            // orphan the buffer so the driver doesn't have to wait for the previous batch to finish drawing
+            glBufferData(GL_ARRAY_BUFFER, MAX_BATCH_SPRITES * 240, nullptr, GL_STREAM_DRAW);
+            glBufferSubData(GL_ARRAY_BUFFER, 0, count * 240, vertexData.data());
+            ++statistics.Uploads;
+            statistics.BytesUploaded += count * 240;
+
+            // one draw call per run of sprites sharing a texture
+            std::size_t runStart = 0;
+            GLuint runTexture = jobs[first].Texture->Use();
+            bool runPremultiplied = jobs[first].Texture->IsPremultiplied();
+
+            for (std::size_t i = 1; i <= count; ++i)
+            {
+                GLuint texture = i < count ? jobs[first + i].Texture->Use() : 0;
+
+                if (texture != runTexture)
+                {
+                    const bool premultiplyTexture = premultiply && !runPremultiplied;
+
+                    // the uniform is only changed when switching between straight and premultiplied textures
+                    if (premultiplyTexture != shaderPremultiplies)
+                    {
+                        shader->SetUniform("premultiplyTexture", premultiplyTexture ? 1.0f : 0.0f);
+                        shaderPremultiplies = premultiplyTexture;
+                    }
+
+                    glBindTexture(GL_TEXTURE_2D, runTexture);
+                    glDrawElements(GL_TRIANGLES, (i - runStart) * 6, GL_UNSIGNED_INT, (void*)(runStart * 6 * sizeof(GLuint)));
+                    ++statistics.DrawCalls;
+                    runStart = i;
+                    runTexture = texture;
+                    runPremultiplied = i < count && jobs[first + i].Texture->IsPremultiplied();
+                }
+            }
+        }
+
         jobs.clear();
     }
 
@@ -679,15 +737,19 @@ namespace FaceEngine
         "in vec4 fragColour;\n"
         
         "uniform sampler2D textureSampler;\n"
+        "uniform float premultiplyTexture;\n"
 
         "void main()\n"
         "{\n"
-            "ivec2 texSize = textureSize(textureSampler, 0);"
-            "fragmentColour = texelFetch(textureSampler, ivec2(floor(fragTexCoord.x), floor(texSize.y - fragTexCoord.y)), 0) * fragColour;"
-            "if (fragmentColour.w == 0.0) { discard; }\n"
+            // texture coordinates are in texels from the top left, normalised here so filtering and mip selection apply
+            "vec2 texSize = vec2(textureSize(textureSampler, 0));"
+            "vec4 texel = texture(textureSampler, vec2(fragTexCoord.x, texSize.y - fragTexCoord.y) / texSize);\n"
+            "texel.rgb *= mix(1.0, texel.a, premultiplyTexture);\n"
+            "fragmentColour = texel * fragColour;\n"
         "}");
         
         SpriteBatcher* result = new SpriteBatcher(win, rm, shader);
+        rm->GetGPUMemoryTracker().Allocate(GPUMemoryBuffers, result->GetGPUMemorySize());
         rm->TrackResource(result);
         return result;
     }
@@ -1,33 +1,176 @@
 #include "FaceEngine/Graphics/Texture2D.h"
 
+#include <algorithm>
+
 namespace FaceEngine
 {
-    void Texture2D::Dispose() noexcept
+    std::uint32_t Texture2D::GetMaxMipLevels(const std::uint32_t w, const std::uint32_t h) noexcept
+    {
+        std::uint32_t levels = 1;
+
+        for (std::uint32_t size = std::max(w, h); size > 1; size >>= 1)
+        {
+            ++levels;
+        }
+
+        return levels;
+    }
+
+    std::size_t Texture2D::GetMipChainSize(const std::uint32_t w, const std::uint32_t h, std::uint32_t levels) noexcept
+    {
+        std::size_t size = 0;
+
+        for (std::uint32_t level = 0; level < levels; ++level)
+        {
+            size += (std::size_t)std::max(w >> level, 1U) * std::max(h >> level, 1U) * 4;
+        }
+
+        return size;
+    }
+
+    std::uint32_t Texture2D::GetUploadLevels(std::uint32_t levels) const noexcept
+    {
+        if (!options.Mipmaps)
+        {
+            return 1;
+        }
+
+        return levels > 1 ? levels : GetMaxMipLevels(width, height);
+    }
+
+    void Texture2D::Upload(const std::uint8_t* data, std::uint32_t levels) noexcept
+    {
+        static const GLint wrapModes[] = { GL_REPEAT, GL_CLAMP_TO_EDGE, GL_MIRRORED_REPEAT };
+        static const GLint minFilters[2][2] = { { GL_NEAREST, GL_LINEAR }, { GL_NEAREST_MIPMAP_LINEAR, GL_LINEAR_MIPMAP_LINEAR } };
+
+        mipLevels = GetUploadLevels(levels);
+        glGenTextures(1, &handle);
+        glBindTexture(GL_TEXTURE_2D, handle);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, wrapModes[options.Wrap]);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, wrapModes[options.Wrap]);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, minFilters[options.Mipmaps][options.MinFilter]);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, options.MagFilter == TextureFilterLinear ? GL_LINEAR : GL_NEAREST);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL, mipLevels - 1);
+        glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+
+        if (mipLevels > 1 && levels == 1)
+        {
+            glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA8, width, height, 0, GL_RGBA, GL_UNSIGNED_BYTE, data);
+            glGenerateMipmap(GL_TEXTURE_2D);
+            return;
+        }
+
+        // precomputed mip levels follow the base level in the image data
+        for (std::uint32_t level = 0; level < mipLevels; ++level)
+        {
+            std::uint32_t w = std::max(width >> level, 1U);
+            std::uint32_t h = std::max(height >> level, 1U);
+            glTexImage2D(GL_TEXTURE_2D, level, GL_RGBA8, w, h, 0, GL_RGBA, GL_UNSIGNED_BYTE, data);
+
+            if (data)
+            {
+                data += (std::size_t)w * h * 4;
+            }
+        }
+    }
+
+    void Texture2D::Evict() noexcept
     {
         if (handle != 0)
         {
-            glDeleteTextures(1, &handle);
+            resMan->GetGPUMemoryTracker().Unlink(this);
+            resMan->GetGPUMemoryTracker().Free(GPUMemoryTextures, GetGPUMemorySize());
+            resMan->DeleteTexture(handle);
             handle = 0;
         }
     }
 
+    void Texture2D::Dispose() noexcept
+    {
+        Evict();
+        disposed = true;
+    }
+
+    void Texture2D::SetEvictable(bool e)
+    {
+        if (e && !reloader)
+        {
+            throw Exception::FromMessage("FaceEngine::Texture2D::SetEvictable", "Only textures loaded from content files can be evicted.");
+        }
+
+        evictable = e;
+
+        if (!e)
+        {
+            resMan->GetGPUMemoryTracker().Unlink(this);
+        }
+        else if (handle != 0)
+        {
+            resMan->GetGPUMemoryTracker().Touch(this);
+        }
+    }
+
+    GLuint Texture2D::Use()
+    {
+        if (disposed)
+        {
+            throw Exception::FromMessage("FaceEngine::Texture2D::Use", "Texture has been disposed.");
+        }
+        else if (page)
+        {
+            return page->Use();
+        }
+
+        GPUMemoryTracker& tracker = resMan->GetGPUMemoryTracker();
+
+        if (handle == 0)
+        {
+            std::unique_ptr<std::uint8_t[]> data = reloader();
+            tracker.Allocate(GPUMemoryTextures, GetMipChainSize(width, height, GetUploadLevels(dataLevels)));
+            Upload(data.get(), dataLevels);
+        }
+
+        lastUsed = tracker.GetFrame();
+
+        if (evictable)
+        {
+            tracker.Touch(this);
+        }
+
+        return handle;
+    }
+
     Texture2D* Texture2D::CreateTexture2D(ResourceManager* rm, const std::uint32_t w, const std::uint32_t h, std::uint8_t* data)
+    {
+        return CreateTexture2D(rm, w, h, data, TextureOptions());
+    }
+
+    Texture2D* Texture2D::CreateTexture2D(ResourceManager* rm, const std::uint32_t w, const std::uint32_t h, std::uint8_t* data, const TextureOptions& options, std::uint32_t levels)
     {
         if (w < 1 || h < 1)
         {
             throw Exception::FromMessage("FaceEngine::Texture2D::CreateTexture2D", "Width and height of texture must be more than 0.");
         }
+        else if (levels < 1 || levels > GetMaxMipLevels(w, h))
+        {
+            throw Exception::FromMessage("FaceEngine::Texture2D::CreateTexture2D", "Invalid number of mip levels.");
+        }
+
+        Texture2D* tex = new Texture2D(rm, w, h, options);
+        tex->dataLevels = levels;
+
+        try
+        {
+            rm->GetGPUMemoryTracker().Allocate(GPUMemoryTextures, GetMipChainSize(w, h, tex->GetUploadLevels(levels)));
+        }
+        catch (const Exception&)
+        {
+            delete tex;
+            throw;
+        }
 
-        GLuint texId;
-        glGenTextures(1, &texId);
-        glBindTexture(GL_TEXTURE_2D, texId);
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_REPEAT);
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_REPEAT);
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
-        glPixelStorei(GL_PACK_ALIGNMENT, 4);
-        glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA8, w, h, 0, GL_RGBA, GL_UNSIGNED_BYTE, data);
-        Texture2D* tex = new Texture2D(texId, w, h);
+        tex->Upload(data, levels);
+        tex->lastUsed = rm->GetGPUMemoryTracker().GetFrame();
         rm->TrackResource(tex);
         return tex;
     }
@@ -0,0 +1,194 @@
+#include "FaceEngine/Graphics/TextureAtlas.h"
+
+#include <limits>
+
+namespace FaceEngine
+{
+    void TextureAtlas::Dispose() noexcept
+    {
+        for (ResourceHandle region : regions)
+        {
+            DisposeTracked(region);
+        }
+
+        for (const Page& page : pages)
+        {
+            DisposeTracked(page.Handle);
+        }
+
+        regions.clear();
+        pages.clear();
+        disposed = true;
+    }
+
+    void TextureAtlas::DisposeTracked(ResourceHandle handle) noexcept
+    {
+        // a stale handle means the caller has already disposed the texture
+        Resource* r = resMan->GetResource(handle);
+
+        if (r != nullptr)
+        {
+            resMan->DisposeResource(r);
+        }
+    }
+
+    bool TextureAtlas::Fit(const Page& page, std::uint32_t w, std::uint32_t h, std::size_t& node, std::uint32_t& x, std::uint32_t& y) const noexcept
+    {
+        std::uint32_t bestBottom = std::numeric_limits<std::uint32_t>::max();
+        std::uint32_t bestWidth = std::numeric_limits<std::uint32_t>::max();
+
+        // bottom-left heuristic: place the image as high up as possible, preferring the narrowest skyline level on ties
+        for (std::size_t i = 0; i < page.Skyline.size(); ++i)
+        {
+            const SkylineNode& start = page.Skyline[i];
+
+            if (start.X + w > pageWidth)
+            {
+                break;
+            }
+
+            std::uint32_t top = 0;
+            std::uint32_t remaining = w;
+
+            for (std::size_t j = i; remaining > 0; ++j)
+            {
+                top = std::max(top, page.Skyline[j].Y);
+                remaining -= std::min(remaining, page.Skyline[j].Width);
+            }
+
+            if (top + h <= pageHeight && (top + h < bestBottom || (top + h == bestBottom && start.Width < bestWidth)))
+            {
+                bestBottom = top + h;
+                bestWidth = start.Width;
+                node = i;
+                x = start.X;
+                y = top;
+            }
+        }
+
+        return bestBottom != std::numeric_limits<std::uint32_t>::max();
+    }
+
+    void TextureAtlas::AddSkylineLevel(Page& page, std::size_t node, std::uint32_t x, std::uint32_t y, std::uint32_t w, std::uint32_t h)
+    {
+        std::vector<SkylineNode>& skyline = page.Skyline;
+        skyline.insert(skyline.begin() + node, SkylineNode { x, y + h, w });
+
+        // shrink or remove the levels now covered by the new one
+        for (std::size_t i = node + 1; i < skyline.size();)
+        {
+            std::uint32_t end = skyline[i - 1].X + skyline[i - 1].Width;
+
+            if (skyline[i].X >= end)
+            {
+                break;
+            }
+
+            std::uint32_t overlap = end - skyline[i].X;
+
+            if (skyline[i].Width <= overlap)
+            {
+                skyline.erase(skyline.begin() + i);
+            }
+            else
+            {
+                skyline[i].X += overlap;
+                skyline[i].Width -= overlap;
+                break;
+            }
+        }
+
+        // merge neighbouring levels of the same height
+        for (std::size_t i = 0; i + 1 < skyline.size();)
+        {
+            if (skyline[i].Y == skyline[i + 1].Y)
+            {
+                skyline[i].Width += skyline[i + 1].Width;
+                skyline.erase(skyline.begin() + i + 1);
+            }
+            else
+            {
+                ++i;
+            }
+        }
+    }
+
+    void TextureAtlas::AddPage()
+    {
+        // pages start out transparent so padding between images never samples uninitialised memory
+        std::vector<std::uint8_t> clear((std::size_t)pageWidth * pageHeight * 4, 0);
+        Texture2D* texture = Texture2D::CreateTexture2D(resMan, pageWidth, pageHeight, clear.data());
+        texture->premultiplied = premultiplied;
+        Page page { texture, texture->GetResourceHandle(), { SkylineNode { 0, 0, pageWidth } } };
+        pages.push_back(std::move(page));
+    }
+
+    Texture2D* TextureAtlas::Add(std::uint32_t w, std::uint32_t h, const std::uint8_t* data)
+    {
+        if (w < 1 || h < 1)
+        {
+            throw Exception::FromMessage("FaceEngine::TextureAtlas::Add", "Width and height of texture must be more than 0.");
+        }
+        else if (w + padding > pageWidth || h + padding > pageHeight)
+        {
+            throw Exception::FromMessage("FaceEngine::TextureAtlas::Add", "Texture is larger than the atlas page size.");
+        }
+
+        std::size_t node;
+        std::uint32_t x, y;
+        std::size_t pageIndex = 0;
+
+        // try every existing page before creating a new one
+        while (pageIndex < pages.size() && !Fit(pages[pageIndex], w + padding, h + padding, node, x, y))
+        {
+            ++pageIndex;
+        }
+
+        if (pageIndex == pages.size())
+        {
+            AddPage();
+            Fit(pages[pageIndex], w + padding, h + padding, node, x, y);
+        }
+
+        Page& page = pages[pageIndex];
+        AddSkylineLevel(page, node, x, y, w + padding, h + padding);
+
+        // the skyline is top-down like sprite source rectangles, OpenGL rows are bottom-up
+        glBindTexture(GL_TEXTURE_2D, page.Texture->Use());
+        glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+        glTexSubImage2D(GL_TEXTURE_2D, 0, x, pageHeight - y - h, w, h, GL_RGBA, GL_UNSIGNED_BYTE, data);
+
+        Texture2D* region = new Texture2D(resMan, w, h, page.Texture->GetOptions());
+        region->page = page.Texture;
+        region->premultiplied = premultiplied;
+        region->sourceX = x;
+        region->sourceY = y;
+        resMan->TrackResource(region);
+        regions.push_back(region->GetResourceHandle());
+        return region;
+    }
+
+    std::size_t TextureAtlas::GetCPUMemorySize() const noexcept
+    {
+        std::size_t size = sizeof(TextureAtlas) + pages.capacity() * sizeof(Page) + regions.capacity() * sizeof(ResourceHandle);
+
+        for (const Page& page : pages)
+        {
+            size += page.Skyline.capacity() * sizeof(SkylineNode);
+        }
+
+        return size;
+    }
+
+    TextureAtlas* TextureAtlas::CreateTextureAtlas(ResourceManager* rm, std::uint32_t pageWidth, std::uint32_t pageHeight, std::uint32_t padding, bool premultiplied)
+    {
+        if (pageWidth < 1 || pageHeight < 1)
+        {
+            throw Exception::FromMessage("FaceEngine::TextureAtlas::CreateTextureAtlas", "Width and height of atlas pages must be more than 0.");
+        }
+
+        TextureAtlas* atlas = new TextureAtlas(rm, pageWidth, pageHeight, padding, premultiplied);
+        rm->TrackResource(atlas);
+        return atlas;
+    }
+}
\ No newline at end of file
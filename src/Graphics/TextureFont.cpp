@@ -4,9 +4,17 @@ namespace FaceEngine
 {
     void TextureFont::Dispose() noexcept
     {
-        for (const FontChar& fontChar : fontChars)
+        if (atlas)
+        {
+            resMan->DisposeResource(atlas);
+            atlas = nullptr;
+        }
+        else
         {
-            resMan->DisposeResource(fontChar.GetTexture());
+            for (const FontChar& fontChar : fontChars)
+            {
+                resMan->DisposeResource(fontChar.GetTexture());
+            }
         }
 
         fontChars.clear();
@@ -89,9 +97,9 @@ namespace FaceEngine
         return result;
     }
 
-    TextureFont* TextureFont::CreateTextureFont(ResourceManager* rm, std::uint32_t size, std::int32_t ascender, std::int32_t descender, std::int32_t lineSpacing, const std::vector<FontChar>& fontChars)
+    TextureFont* TextureFont::CreateTextureFont(ResourceManager* rm, std::uint32_t size, std::int32_t ascender, std::int32_t descender, std::int32_t lineSpacing, const std::vector<FontChar>& fontChars, TextureAtlas* atlas)
     {
-        TextureFont* font = new TextureFont(rm, size, ascender, descender, lineSpacing, fontChars);
+        TextureFont* font = new TextureFont(rm, size, ascender, descender, lineSpacing, fontChars, atlas);
         rm->TrackResource(font);
         return font;
     }
@@ -26,4 +26,13 @@ namespace FaceEngine
             displays.push_back(std::move(display));
         }
     }
+
+    GraphicsDevice::GraphicsDevice(const Resolution& resolution)
+    {
+        Display display;
+        display.handle = nullptr;
+        display.primary = true;
+        display.resolutions.push_back(resolution);
+        displays.push_back(std::move(display));
+    }
 }
\ No newline at end of file
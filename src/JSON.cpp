@@ -0,0 +1,33 @@
+#include "FaceEngine/JSON.h"
+
+#include <cstdio>
+
+namespace FaceEngine
+{
+    std::string EscapeJSON(const std::string& str)
+    {
+        std::string result;
+        result.reserve(str.size());
+
+        for (char c : str)
+        {
+            if (c == '"' || c == '\\')
+            {
+                result += '\\';
+                result += c;
+            }
+            else if ((unsigned char)c < 0x20)
+            {
+                char escaped[7];
+                std::snprintf(escaped, sizeof(escaped), "\\u%04x", (unsigned char)c);
+                result += escaped;
+            }
+            else
+            {
+                result += c;
+            }
+        }
+
+        return result;
+    }
+}
\ No newline at end of file
@@ -0,0 +1,406 @@
+#include <algorithm>
+#include <chrono>
+
+#include "FaceEngine/JobSystem.h"
+#include "FaceEngine/Exception.h"
+#include "FaceEngine/Profiler.h"
+
+namespace FaceEngine
+{
+    static constexpr std::size_t NoWorker = (std::size_t)-1;
+
+    // the job system and worker index of the current thread, if it is a worker
+    static thread_local const JobSystem* CurrentSystem = nullptr;
+    static thread_local std::size_t CurrentWorker = NoWorker;
+
+    JobSystem::JobSystem(std::size_t workerCount) : queued(0), stopping(false)
+    {
+        disposed = false;
+        mainThread = std::this_thread::get_id();
+
+        if (workerCount == DefaultWorkerCount)
+        {
+            workerCount = std::max(std::thread::hardware_concurrency(), 2U) - 1;
+        }
+
+        for (std::size_t i = 0; i < workerCount; ++i)
+        {
+            workers.emplace_back(new Worker);
+        }
+
+        for (std::size_t i = 0; i < workerCount; ++i)
+        {
+            threads.emplace_back(&JobSystem::WorkerLoop, this, i);
+        }
+    }
+
+    void JobSystem::Dispose() noexcept
+    {
+        if (disposed)
+        {
+            return;
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(sleepMutex);
+            stopping.store(true);
+        }
+
+        wake.notify_all();
+
+        for (std::thread& thread : threads)
+        {
+            thread.join();
+        }
+
+        threads.clear();
+        disposed = true;
+    }
+
+    void JobSystem::WorkerLoop(std::size_t index)
+    {
+        CurrentSystem = this;
+        CurrentWorker = index;
+        Profiler::SetThreadName("Worker " + std::to_string(index + 1));
+
+        while (true)
+        {
+            std::shared_ptr<__JobState> job = Dequeue(index);
+
+            if (job)
+            {
+                Execute(job);
+                continue;
+            }
+
+            std::unique_lock<std::mutex> lock(sleepMutex);
+
+            // queued jobs are finished before stopping, so jobs waiting on them can't hang
+            if (stopping.load() && queued.load() == 0)
+            {
+                return;
+            }
+
+            wake.wait(lock, [this]() { return queued.load() > 0 || stopping.load(); });
+        }
+    }
+
+    void JobSystem::Enqueue(const std::shared_ptr<__JobState>& job)
+    {
+        if (job->MainThread)
+        {
+            std::lock_guard<std::mutex> lock(mainMutex);
+            mainJobs.push_back(job);
+            return;
+        }
+
+        if (CurrentSystem == this)
+        {
+            Worker& worker = *workers[CurrentWorker];
+            std::lock_guard<std::mutex> lock(worker.Mutex);
+            worker.Jobs.push_back(job);
+        }
+        else
+        {
+            std::lock_guard<std::mutex> lock(sharedMutex);
+            sharedJobs.push_back(job);
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(sleepMutex);
+            queued.fetch_add(1);
+        }
+
+        wake.notify_one();
+    }
+
+    std::shared_ptr<__JobState> JobSystem::Dequeue(std::size_t self) noexcept
+    {
+        std::shared_ptr<__JobState> job;
+
+        // own jobs newest first, as their data is most likely to still be in the cache
+        if (self != NoWorker)
+        {
+            Worker& worker = *workers[self];
+            std::lock_guard<std::mutex> lock(worker.Mutex);
+
+            if (!worker.Jobs.empty())
+            {
+                job = std::move(worker.Jobs.back());
+                worker.Jobs.pop_back();
+            }
+        }
+
+        if (!job)
+        {
+            std::lock_guard<std::mutex> lock(sharedMutex);
+
+            if (!sharedJobs.empty())
+            {
+                job = std::move(sharedJobs.front());
+                sharedJobs.pop_front();
+            }
+        }
+
+        // steal the oldest job of another worker, starting after this one so thieves spread out
+        std::size_t start = self == NoWorker ? 0 : self + 1;
+
+        for (std::size_t i = 0; !job && i < workers.size(); ++i)
+        {
+            std::size_t victim = (start + i) % workers.size();
+
+            if (victim == self)
+            {
+                continue;
+            }
+
+            Worker& worker = *workers[victim];
+            std::lock_guard<std::mutex> lock(worker.Mutex);
+
+            if (!worker.Jobs.empty())
+            {
+                job = std::move(worker.Jobs.front());
+                worker.Jobs.pop_front();
+            }
+        }
+
+        if (job)
+        {
+            queued.fetch_sub(1);
+        }
+
+        return job;
+    }
+
+    bool JobSystem::RunMainThreadJob()
+    {
+        std::shared_ptr<__JobState> job;
+
+        {
+            std::lock_guard<std::mutex> lock(mainMutex);
+
+            if (mainJobs.empty())
+            {
+                return false;
+            }
+
+            job = std::move(mainJobs.front());
+            mainJobs.pop_front();
+        }
+
+        Execute(job);
+        return true;
+    }
+
+    void JobSystem::Execute(const std::shared_ptr<__JobState>& job)
+    {
+        try
+        {
+            FACE_PROFILE_SCOPE("Job");
+            job->Function();
+        }
+        catch (...)
+        {
+            job->Error = std::current_exception();
+        }
+
+        job->Function = nullptr;
+        std::vector<std::shared_ptr<__JobState>> continuations;
+
+        {
+            std::lock_guard<std::mutex> lock(job->Mutex);
+            job->Done.store(true, std::memory_order_release);
+            continuations.swap(job->Continuations);
+        }
+
+        for (const std::shared_ptr<__JobState>& continuation : continuations)
+        {
+            if (continuation->Dependencies.fetch_sub(1) == 1)
+            {
+                Enqueue(continuation);
+            }
+        }
+    }
+
+    JobHandle JobSystem::Schedule(std::function<void()> function, const std::vector<JobHandle>& dependencies, bool onMainThread)
+    {
+        if (disposed)
+        {
+            throw Exception::FromMessage("FaceEngine::JobSystem::Schedule", "Job system has been disposed.");
+        }
+
+        std::shared_ptr<__JobState> job = std::make_shared<__JobState>();
+        job->Function = std::move(function);
+        job->MainThread = onMainThread;
+
+        for (const JobHandle& dependency : dependencies)
+        {
+            if (dependency.state == nullptr)
+            {
+                continue;
+            }
+
+            std::lock_guard<std::mutex> lock(dependency.state->Mutex);
+
+            if (!dependency.state->Done.load())
+            {
+                job->Dependencies.fetch_add(1);
+                dependency.state->Continuations.push_back(job);
+            }
+        }
+
+        // drop the scheduling reference, which queues the job if its dependencies have already finished
+        if (job->Dependencies.fetch_sub(1) == 1)
+        {
+            Enqueue(job);
+        }
+
+        return JobHandle(job);
+    }
+
+    JobHandle JobSystem::Schedule(std::function<void()> function)
+    {
+        return Schedule(std::move(function), std::vector<JobHandle>(), false);
+    }
+
+    JobHandle JobSystem::Schedule(std::function<void()> function, const std::vector<JobHandle>& dependencies)
+    {
+        return Schedule(std::move(function), dependencies, false);
+    }
+
+    JobHandle JobSystem::ScheduleMainThread(std::function<void()> function, const std::vector<JobHandle>& dependencies)
+    {
+        return Schedule(std::move(function), dependencies, true);
+    }
+
+    void JobSystem::RunMainThreadJobs()
+    {
+        if (!IsMainThread())
+        {
+            throw Exception::FromMessage("FaceEngine::JobSystem::RunMainThreadJobs", "Main thread jobs can only be run on the main thread.");
+        }
+
+        // jobs queued while running these wait for the next frame, so a job that requeues itself can't stall the frame
+        std::size_t count = 0;
+
+        // without workers nothing else runs the jobs nobody waits for
+        if (threads.empty())
+        {
+            {
+                std::lock_guard<std::mutex> lock(sharedMutex);
+                count = sharedJobs.size();
+            }
+
+            for (std::shared_ptr<__JobState> job; count > 0 && (job = Dequeue(NoWorker)); --count)
+            {
+                Execute(job);
+            }
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(mainMutex);
+            count = mainJobs.size();
+        }
+
+        for (std::size_t i = 0; i < count && RunMainThreadJob(); ++i) { }
+    }
+
+    void JobSystem::Wait(const JobHandle& handle)
+    {
+        bool onMainThread = IsMainThread();
+        std::size_t self = CurrentSystem == this ? CurrentWorker : NoWorker;
+
+        while (!handle.IsComplete())
+        {
+            std::shared_ptr<__JobState> job = Dequeue(self);
+
+            if (job)
+            {
+                Execute(job);
+            }
+            else if (!onMainThread || !RunMainThreadJob())
+            {
+                // the job is running on another thread, or is waiting on one
+                std::unique_lock<std::mutex> lock(sleepMutex);
+                wake.wait_for(lock, std::chrono::microseconds(100), [this]() { return queued.load() > 0; });
+            }
+        }
+
+        if (handle.state->Error)
+        {
+            std::rethrow_exception(handle.state->Error);
+        }
+    }
+
+    void JobSystem::ParallelFor(std::size_t begin, std::size_t end, std::size_t grainSize, const std::function<void(std::size_t, std::size_t)>& function)
+    {
+        if (begin >= end)
+        {
+            return;
+        }
+
+        std::size_t count = end - begin;
+        std::size_t threadCount = threads.size() + 1;
+
+        if (grainSize == 0)
+        {
+            grainSize = std::max<std::size_t>(count / (threadCount * 4), 1);
+        }
+
+        std::size_t chunkCount = (count + grainSize - 1) / grainSize;
+        std::atomic_size_t nextChunk(0);
+
+        auto run = [&]()
+        {
+            std::size_t chunk;
+
+            while ((chunk = nextChunk.fetch_add(1)) < chunkCount)
+            {
+                std::size_t chunkBegin = begin + chunk * grainSize;
+                function(chunkBegin, std::min(chunkBegin + grainSize, end));
+            }
+        };
+
+        // helpers take chunks until none are left, so they finish together however the chunks vary in cost
+        std::vector<JobHandle> helpers;
+        std::size_t helperCount = std::min(threads.size(), chunkCount - 1);
+
+        for (std::size_t i = 0; i < helperCount; ++i)
+        {
+            helpers.push_back(Schedule(run));
+        }
+
+        std::exception_ptr error;
+
+        try
+        {
+            run();
+        }
+        catch (...)
+        {
+            error = std::current_exception();
+            nextChunk.store(chunkCount);
+        }
+
+        // the helpers reference this stack frame, so every one must finish before returning or throwing
+        for (const JobHandle& helper : helpers)
+        {
+            try
+            {
+                Wait(helper);
+            }
+            catch (...)
+            {
+                if (!error)
+                {
+                    error = std::current_exception();
+                }
+            }
+        }
+
+        if (error)
+        {
+            std::rethrow_exception(error);
+        }
+    }
+}
\ No newline at end of file
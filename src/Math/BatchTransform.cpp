@@ -0,0 +1,438 @@
+#include "FaceEngine/Math/Matrix3f.h"
+#include "FaceEngine/Math/Matrix4f.h"
+#include "FaceEngine/Math/SIMD.h"
+#include <cmath>
+
+/*
+ * The array overloads of Matrix3f::Transform, Matrix4f::Transform and TransformBounds. Both matrix types reduce to the same 2D and 3D affine
+ * coefficients, so they share the kernels here.
+ *
+ * The arrays hold structures (X, Y, X, Y, ...), so each SIMD kernel loads a block of elements, shuffles them into one register of X components,
+ * one of Y components and so on, transforms 4 (SSE, NEON) or 8 (AVX) elements with one instruction per coefficient and shuffles the results back.
+ * Whatever is left after the last whole block is transformed one element at a time.
+ */
+
+static_assert(std::is_standard_layout<FaceEngine::Rectanglef>() && sizeof(FaceEngine::Rectanglef) == 4 * sizeof(float), "The bounds kernels read Rectanglef arrays as floats.");
+
+namespace FaceEngine
+{
+    namespace
+    {
+        // x' = M11 * x + M12 * y + M13, y' = M21 * x + M22 * y + M23
+        struct Affine2D
+        {
+            float M11, M12, M13, M21, M22, M23;
+        };
+
+        // the first three rows of a 4x4 matrix, the fourth column being the translation
+        struct Affine3D
+        {
+            float M11, M12, M13, M14, M21, M22, M23, M24, M31, M32, M33, M34;
+        };
+
+        inline void TransformPoint(const Affine2D& m, const Vector2f& source, Vector2f& destination) noexcept
+        {
+            float x = source.X;
+            float y = source.Y;
+
+            destination.X = m.M11 * x + m.M12 * y + m.M13;
+            destination.Y = m.M21 * x + m.M22 * y + m.M23;
+        }
+
+        inline void TransformPoint(const Affine3D& m, const Vector3f& source, Vector3f& destination) noexcept
+        {
+            float x = source.X;
+            float y = source.Y;
+            float z = source.Z;
+
+            destination.X = m.M11 * x + m.M12 * y + m.M13 * z + m.M14;
+            destination.Y = m.M21 * x + m.M22 * y + m.M23 * z + m.M24;
+            destination.Z = m.M31 * x + m.M32 * y + m.M33 * z + m.M34;
+        }
+
+        /*
+         * An affine transform maps the centre of a rectangle to the centre of its bounds, and each corner lies at most |M11 * w / 2| + |M12 * h / 2|
+         * from it horizontally (likewise vertically), so the bounds come from the centre and half size without transforming all four corners.
+         */
+        inline void TransformBound(const Affine2D& m, const Rectanglef& source, Rectanglef& destination) noexcept
+        {
+            float halfWidth = source.Width * 0.5f;
+            float halfHeight = source.Height * 0.5f;
+            float x = source.X + halfWidth;
+            float y = source.Y + halfHeight;
+            float extentX = std::abs(m.M11 * halfWidth) + std::abs(m.M12 * halfHeight);
+            float extentY = std::abs(m.M21 * halfWidth) + std::abs(m.M22 * halfHeight);
+
+            destination.X = m.M11 * x + m.M12 * y + m.M13 - extentX;
+            destination.Y = m.M21 * x + m.M22 * y + m.M23 - extentY;
+            destination.Width = extentX * 2.0f;
+            destination.Height = extentY * 2.0f;
+        }
+
+#if defined(FACE_ENGINE_SSE)
+        inline __m128 Abs(__m128 v) noexcept
+        {
+            return _mm_andnot_ps(_mm_set1_ps(-0.0f), v);
+        }
+
+        // a = x0 y0 z0 x1, b = y1 z1 x2 y2, c = z2 x3 y3 z3
+        inline void Deinterleave3(__m128 a, __m128 b, __m128 c, __m128& x, __m128& y, __m128& z) noexcept
+        {
+            x = _mm_shuffle_ps(a, _mm_shuffle_ps(b, c, _MM_SHUFFLE(1, 1, 2, 2)), _MM_SHUFFLE(2, 0, 3, 0));
+            y = _mm_shuffle_ps(_mm_shuffle_ps(a, b, _MM_SHUFFLE(0, 0, 1, 1)), _mm_shuffle_ps(b, c, _MM_SHUFFLE(2, 2, 3, 3)), _MM_SHUFFLE(2, 0, 2, 0));
+            z = _mm_shuffle_ps(_mm_shuffle_ps(a, b, _MM_SHUFFLE(1, 1, 2, 2)), c, _MM_SHUFFLE(3, 0, 2, 0));
+        }
+
+        inline void Interleave3(__m128 x, __m128 y, __m128 z, __m128& a, __m128& b, __m128& c) noexcept
+        {
+            a = _mm_shuffle_ps(_mm_shuffle_ps(x, y, _MM_SHUFFLE(0, 0, 0, 0)), _mm_shuffle_ps(z, x, _MM_SHUFFLE(1, 1, 0, 0)), _MM_SHUFFLE(2, 0, 2, 0));
+            b = _mm_shuffle_ps(_mm_shuffle_ps(y, z, _MM_SHUFFLE(1, 1, 1, 1)), _mm_shuffle_ps(x, y, _MM_SHUFFLE(2, 2, 2, 2)), _MM_SHUFFLE(2, 0, 2, 0));
+            c = _mm_shuffle_ps(_mm_shuffle_ps(z, x, _MM_SHUFFLE(3, 3, 2, 2)), _mm_shuffle_ps(y, z, _MM_SHUFFLE(3, 3, 3, 3)), _MM_SHUFFLE(2, 0, 2, 0));
+        }
+#endif
+
+#if defined(FACE_ENGINE_AVX)
+        inline __m256 Abs(__m256 v) noexcept
+        {
+            return _mm256_andnot_ps(_mm256_set1_ps(-0.0f), v);
+        }
+
+        // transposes the 4x4 matrix in each 128-bit half of four registers, like _MM_TRANSPOSE4_PS
+        inline void Transpose4x4(__m256& row1, __m256& row2, __m256& row3, __m256& row4) noexcept
+        {
+            __m256 low12 = _mm256_unpacklo_ps(row1, row2);
+            __m256 high12 = _mm256_unpackhi_ps(row1, row2);
+            __m256 low34 = _mm256_unpacklo_ps(row3, row4);
+            __m256 high34 = _mm256_unpackhi_ps(row3, row4);
+
+            row1 = _mm256_shuffle_ps(low12, low34, _MM_SHUFFLE(1, 0, 1, 0));
+            row2 = _mm256_shuffle_ps(low12, low34, _MM_SHUFFLE(3, 2, 3, 2));
+            row3 = _mm256_shuffle_ps(high12, high34, _MM_SHUFFLE(1, 0, 1, 0));
+            row4 = _mm256_shuffle_ps(high12, high34, _MM_SHUFFLE(3, 2, 3, 2));
+        }
+
+        // elements i and i + 4 of a float4 array in the two halves
+        inline __m256 LoadPair(const float* source) noexcept
+        {
+            return _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(source)), _mm_loadu_ps(source + 16), 1);
+        }
+
+        inline void StorePair(float* destination, __m256 v) noexcept
+        {
+            _mm_storeu_ps(destination, _mm256_castps256_ps128(v));
+            _mm_storeu_ps(destination + 16, _mm256_extractf128_ps(v, 1));
+        }
+#endif
+
+        void TransformPoints(const Affine2D& m, const Vector2f* source, Vector2f* destination, std::size_t count) noexcept
+        {
+            std::size_t i = 0;
+
+#if defined(FACE_ENGINE_SSE) || defined(FACE_ENGINE_NEON)
+            const float* in = reinterpret_cast<const float*>(source);
+            float* out = reinterpret_cast<float*>(destination);
+#endif
+
+#if defined(FACE_ENGINE_AVX)
+            __m256 m11 = _mm256_set1_ps(m.M11), m12 = _mm256_set1_ps(m.M12), m13 = _mm256_set1_ps(m.M13);
+            __m256 m21 = _mm256_set1_ps(m.M21), m22 = _mm256_set1_ps(m.M22), m23 = _mm256_set1_ps(m.M23);
+
+            for (; i + 8 <= count; i += 8)
+            {
+                __m256 a = _mm256_loadu_ps(&in[i * 2]);
+                __m256 b = _mm256_loadu_ps(&in[i * 2 + 8]);
+
+                // shuffles stay within each 128-bit half, so the lanes hold elements 0 1 4 5 | 2 3 6 7 until unpacking restores the order
+                __m256 x = _mm256_shuffle_ps(a, b, _MM_SHUFFLE(2, 0, 2, 0));
+                __m256 y = _mm256_shuffle_ps(a, b, _MM_SHUFFLE(3, 1, 3, 1));
+                __m256 resultX = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(m11, x), _mm256_mul_ps(m12, y)), m13);
+                __m256 resultY = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(m21, x), _mm256_mul_ps(m22, y)), m23);
+
+                _mm256_storeu_ps(&out[i * 2], _mm256_unpacklo_ps(resultX, resultY));
+                _mm256_storeu_ps(&out[i * 2 + 8], _mm256_unpackhi_ps(resultX, resultY));
+            }
+#endif
+#if defined(FACE_ENGINE_SSE)
+            __m128 s11 = _mm_set1_ps(m.M11), s12 = _mm_set1_ps(m.M12), s13 = _mm_set1_ps(m.M13);
+            __m128 s21 = _mm_set1_ps(m.M21), s22 = _mm_set1_ps(m.M22), s23 = _mm_set1_ps(m.M23);
+
+            for (; i + 4 <= count; i += 4)
+            {
+                __m128 a = _mm_loadu_ps(&in[i * 2]);
+                __m128 b = _mm_loadu_ps(&in[i * 2 + 4]);
+                __m128 x = _mm_shuffle_ps(a, b, _MM_SHUFFLE(2, 0, 2, 0));
+                __m128 y = _mm_shuffle_ps(a, b, _MM_SHUFFLE(3, 1, 3, 1));
+                __m128 resultX = _mm_add_ps(_mm_add_ps(_mm_mul_ps(s11, x), _mm_mul_ps(s12, y)), s13);
+                __m128 resultY = _mm_add_ps(_mm_add_ps(_mm_mul_ps(s21, x), _mm_mul_ps(s22, y)), s23);
+
+                _mm_storeu_ps(&out[i * 2], _mm_unpacklo_ps(resultX, resultY));
+                _mm_storeu_ps(&out[i * 2 + 4], _mm_unpackhi_ps(resultX, resultY));
+            }
+#elif defined(FACE_ENGINE_NEON)
+            for (; i + 4 <= count; i += 4)
+            {
+                float32x4x2_t v = vld2q_f32(&in[i * 2]);
+                float32x4x2_t result;
+                result.val[0] = vmlaq_n_f32(vmlaq_n_f32(vdupq_n_f32(m.M13), v.val[0], m.M11), v.val[1], m.M12);
+                result.val[1] = vmlaq_n_f32(vmlaq_n_f32(vdupq_n_f32(m.M23), v.val[0], m.M21), v.val[1], m.M22);
+                vst2q_f32(&out[i * 2], result);
+            }
+#endif
+
+            for (; i < count; ++i)
+            {
+                TransformPoint(m, source[i], destination[i]);
+            }
+        }
+
+        // the lane-crossing shuffles an AVX version would need cost about what it saves, so AVX builds use the SSE kernel
+        void TransformPoints(const Affine3D& m, const Vector3f* source, Vector3f* destination, std::size_t count) noexcept
+        {
+            std::size_t i = 0;
+
+#if defined(FACE_ENGINE_SSE) || defined(FACE_ENGINE_NEON)
+            const float* in = reinterpret_cast<const float*>(source);
+            float* out = reinterpret_cast<float*>(destination);
+#endif
+
+#if defined(FACE_ENGINE_SSE)
+            __m128 s11 = _mm_set1_ps(m.M11), s12 = _mm_set1_ps(m.M12), s13 = _mm_set1_ps(m.M13), s14 = _mm_set1_ps(m.M14);
+            __m128 s21 = _mm_set1_ps(m.M21), s22 = _mm_set1_ps(m.M22), s23 = _mm_set1_ps(m.M23), s24 = _mm_set1_ps(m.M24);
+            __m128 s31 = _mm_set1_ps(m.M31), s32 = _mm_set1_ps(m.M32), s33 = _mm_set1_ps(m.M33), s34 = _mm_set1_ps(m.M34);
+
+            for (; i + 4 <= count; i += 4)
+            {
+                __m128 x, y, z;
+                Deinterleave3(_mm_loadu_ps(&in[i * 3]), _mm_loadu_ps(&in[i * 3 + 4]), _mm_loadu_ps(&in[i * 3 + 8]), x, y, z);
+
+                __m128 resultX = _mm_add_ps(_mm_add_ps(_mm_mul_ps(s11, x), _mm_mul_ps(s12, y)), _mm_add_ps(_mm_mul_ps(s13, z), s14));
+                __m128 resultY = _mm_add_ps(_mm_add_ps(_mm_mul_ps(s21, x), _mm_mul_ps(s22, y)), _mm_add_ps(_mm_mul_ps(s23, z), s24));
+                __m128 resultZ = _mm_add_ps(_mm_add_ps(_mm_mul_ps(s31, x), _mm_mul_ps(s32, y)), _mm_add_ps(_mm_mul_ps(s33, z), s34));
+
+                __m128 a, b, c;
+                Interleave3(resultX, resultY, resultZ, a, b, c);
+                _mm_storeu_ps(&out[i * 3], a);
+                _mm_storeu_ps(&out[i * 3 + 4], b);
+                _mm_storeu_ps(&out[i * 3 + 8], c);
+            }
+#elif defined(FACE_ENGINE_NEON)
+            for (; i + 4 <= count; i += 4)
+            {
+                float32x4x3_t v = vld3q_f32(&in[i * 3]);
+                float32x4x3_t result;
+                result.val[0] = vmlaq_n_f32(vmlaq_n_f32(vmlaq_n_f32(vdupq_n_f32(m.M14), v.val[0], m.M11), v.val[1], m.M12), v.val[2], m.M13);
+                result.val[1] = vmlaq_n_f32(vmlaq_n_f32(vmlaq_n_f32(vdupq_n_f32(m.M24), v.val[0], m.M21), v.val[1], m.M22), v.val[2], m.M23);
+                result.val[2] = vmlaq_n_f32(vmlaq_n_f32(vmlaq_n_f32(vdupq_n_f32(m.M34), v.val[0], m.M31), v.val[1], m.M32), v.val[2], m.M33);
+                vst3q_f32(&out[i * 3], result);
+            }
+#endif
+
+            for (; i < count; ++i)
+            {
+                TransformPoint(m, source[i], destination[i]);
+            }
+        }
+
+        void TransformBounds(const Affine2D& m, const Rectanglef* source, Rectanglef* destination, std::size_t count) noexcept
+        {
+            std::size_t i = 0;
+
+#if defined(FACE_ENGINE_SSE) || defined(FACE_ENGINE_NEON)
+            const float* in = reinterpret_cast<const float*>(source);
+            float* out = reinterpret_cast<float*>(destination);
+#endif
+
+#if defined(FACE_ENGINE_AVX)
+            __m256 m11 = _mm256_set1_ps(m.M11), m12 = _mm256_set1_ps(m.M12), m13 = _mm256_set1_ps(m.M13);
+            __m256 m21 = _mm256_set1_ps(m.M21), m22 = _mm256_set1_ps(m.M22), m23 = _mm256_set1_ps(m.M23);
+            __m256 abs11 = Abs(m11), abs12 = Abs(m12), abs21 = Abs(m21), abs22 = Abs(m22);
+            __m256 half = _mm256_set1_ps(0.5f);
+            __m256 two = _mm256_set1_ps(2.0f);
+
+            for (; i + 8 <= count; i += 8)
+            {
+                // rectangles i to i + 3 in the low halves and i + 4 to i + 7 in the high halves, transposed to X, Y, Width and Height
+                __m256 x = LoadPair(&in[i * 4]);
+                __m256 y = LoadPair(&in[i * 4 + 4]);
+                __m256 width = LoadPair(&in[i * 4 + 8]);
+                __m256 height = LoadPair(&in[i * 4 + 12]);
+                Transpose4x4(x, y, width, height);
+
+                __m256 halfWidth = _mm256_mul_ps(width, half);
+                __m256 halfHeight = _mm256_mul_ps(height, half);
+                x = _mm256_add_ps(x, halfWidth);
+                y = _mm256_add_ps(y, halfHeight);
+                halfWidth = Abs(halfWidth);
+                halfHeight = Abs(halfHeight);
+
+                __m256 extentX = _mm256_add_ps(_mm256_mul_ps(abs11, halfWidth), _mm256_mul_ps(abs12, halfHeight));
+                __m256 extentY = _mm256_add_ps(_mm256_mul_ps(abs21, halfWidth), _mm256_mul_ps(abs22, halfHeight));
+                __m256 resultX = _mm256_sub_ps(_mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(m11, x), _mm256_mul_ps(m12, y)), m13), extentX);
+                __m256 resultY = _mm256_sub_ps(_mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(m21, x), _mm256_mul_ps(m22, y)), m23), extentY);
+                __m256 resultWidth = _mm256_mul_ps(extentX, two);
+                __m256 resultHeight = _mm256_mul_ps(extentY, two);
+
+                Transpose4x4(resultX, resultY, resultWidth, resultHeight);
+                StorePair(&out[i * 4], resultX);
+                StorePair(&out[i * 4 + 4], resultY);
+                StorePair(&out[i * 4 + 8], resultWidth);
+                StorePair(&out[i * 4 + 12], resultHeight);
+            }
+#endif
+#if defined(FACE_ENGINE_SSE)
+            __m128 s11 = _mm_set1_ps(m.M11), s12 = _mm_set1_ps(m.M12), s13 = _mm_set1_ps(m.M13);
+            __m128 s21 = _mm_set1_ps(m.M21), s22 = _mm_set1_ps(m.M22), s23 = _mm_set1_ps(m.M23);
+            __m128 sAbs11 = Abs(s11), sAbs12 = Abs(s12), sAbs21 = Abs(s21), sAbs22 = Abs(s22);
+            __m128 sHalf = _mm_set1_ps(0.5f);
+            __m128 sTwo = _mm_set1_ps(2.0f);
+
+            for (; i + 4 <= count; i += 4)
+            {
+                __m128 x = _mm_loadu_ps(&in[i * 4]);
+                __m128 y = _mm_loadu_ps(&in[i * 4 + 4]);
+                __m128 width = _mm_loadu_ps(&in[i * 4 + 8]);
+                __m128 height = _mm_loadu_ps(&in[i * 4 + 12]);
+                _MM_TRANSPOSE4_PS(x, y, width, height);
+
+                __m128 halfWidth = _mm_mul_ps(width, sHalf);
+                __m128 halfHeight = _mm_mul_ps(height, sHalf);
+                x = _mm_add_ps(x, halfWidth);
+                y = _mm_add_ps(y, halfHeight);
+                halfWidth = Abs(halfWidth);
+                halfHeight = Abs(halfHeight);
+
+                __m128 extentX = _mm_add_ps(_mm_mul_ps(sAbs11, halfWidth), _mm_mul_ps(sAbs12, halfHeight));
+                __m128 extentY = _mm_add_ps(_mm_mul_ps(sAbs21, halfWidth), _mm_mul_ps(sAbs22, halfHeight));
+                __m128 resultX = _mm_sub_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(s11, x), _mm_mul_ps(s12, y)), s13), extentX);
+                __m128 resultY = _mm_sub_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(s21, x), _mm_mul_ps(s22, y)), s23), extentY);
+                __m128 resultWidth = _mm_mul_ps(extentX, sTwo);
+                __m128 resultHeight = _mm_mul_ps(extentY, sTwo);
+
+                _MM_TRANSPOSE4_PS(resultX, resultY, resultWidth, resultHeight);
+                _mm_storeu_ps(&out[i * 4], resultX);
+                _mm_storeu_ps(&out[i * 4 + 4], resultY);
+                _mm_storeu_ps(&out[i * 4 + 8], resultWidth);
+                _mm_storeu_ps(&out[i * 4 + 12], resultHeight);
+            }
+#elif defined(FACE_ENGINE_NEON)
+            for (; i + 4 <= count; i += 4)
+            {
+                // de-interleaving every fourth element splits X, Y, Width and Height
+                float32x4x4_t rect = vld4q_f32(&in[i * 4]);
+                float32x4_t halfWidth = vmulq_n_f32(rect.val[2], 0.5f);
+                float32x4_t halfHeight = vmulq_n_f32(rect.val[3], 0.5f);
+                float32x4_t x = vaddq_f32(rect.val[0], halfWidth);
+                float32x4_t y = vaddq_f32(rect.val[1], halfHeight);
+                halfWidth = vabsq_f32(halfWidth);
+                halfHeight = vabsq_f32(halfHeight);
+
+                float32x4_t extentX = vmlaq_n_f32(vmulq_n_f32(halfWidth, std::abs(m.M11)), halfHeight, std::abs(m.M12));
+                float32x4_t extentY = vmlaq_n_f32(vmulq_n_f32(halfWidth, std::abs(m.M21)), halfHeight, std::abs(m.M22));
+                float32x4x4_t result;
+                result.val[0] = vsubq_f32(vmlaq_n_f32(vmlaq_n_f32(vdupq_n_f32(m.M13), x, m.M11), y, m.M12), extentX);
+                result.val[1] = vsubq_f32(vmlaq_n_f32(vmlaq_n_f32(vdupq_n_f32(m.M23), x, m.M21), y, m.M22), extentY);
+                result.val[2] = vmulq_n_f32(extentX, 2.0f);
+                result.val[3] = vmulq_n_f32(extentY, 2.0f);
+                vst4q_f32(&out[i * 4], result);
+            }
+#endif
+
+            for (; i < count; ++i)
+            {
+                TransformBound(m, source[i], destination[i]);
+            }
+        }
+    }
+
+    void Matrix3f::Transform(const Vector2f* source, Vector2f* destination, std::size_t count) const noexcept
+    {
+        TransformPoints(Affine2D { M11, M12, M13, M21, M22, M23 }, source, destination, count);
+    }
+
+    void Matrix3f::Transform(const Vector3f* source, Vector3f* destination, std::size_t count) const noexcept
+    {
+        TransformPoints(Affine3D { M11, M12, M13, 0, M21, M22, M23, 0, M31, M32, M33, 0 }, source, destination, count);
+    }
+
+    void Matrix3f::TransformBounds(const Rectanglef* source, Rectanglef* destination, std::size_t count) const noexcept
+    {
+        FaceEngine::TransformBounds(Affine2D { M11, M12, M13, M21, M22, M23 }, source, destination, count);
+    }
+
+    void Matrix4f::Transform(const Vector2f* source, Vector2f* destination, std::size_t count) const noexcept
+    {
+        TransformPoints(Affine2D { M11, M12, M14, M21, M22, M24 }, source, destination, count);
+    }
+
+    void Matrix4f::Transform(const Vector3f* source, Vector3f* destination, std::size_t count) const noexcept
+    {
+        TransformPoints(Affine3D { M11, M12, M13, M14, M21, M22, M23, M24, M31, M32, M33, M34 }, source, destination, count);
+    }
+
+    void Matrix4f::Transform(const Vector4f* source, Vector4f* destination, std::size_t count) const noexcept
+    {
+        std::size_t i = 0;
+
+#if defined(FACE_ENGINE_SSE)
+        // Vector4f already fills a register, so these kernels broadcast each component instead of transposing blocks of vectors
+        __m128 column1 = _mm_load_ps(&Elements[0]);
+        __m128 column2 = _mm_load_ps(&Elements[4]);
+        __m128 column3 = _mm_load_ps(&Elements[8]);
+        __m128 column4 = _mm_load_ps(&Elements[12]);
+        _MM_TRANSPOSE4_PS(column1, column2, column3, column4);
+
+#if defined(FACE_ENGINE_AVX)
+        __m256 columns1 = _mm256_insertf128_ps(_mm256_castps128_ps256(column1), column1, 1);
+        __m256 columns2 = _mm256_insertf128_ps(_mm256_castps128_ps256(column2), column2, 1);
+        __m256 columns3 = _mm256_insertf128_ps(_mm256_castps128_ps256(column3), column3, 1);
+        __m256 columns4 = _mm256_insertf128_ps(_mm256_castps128_ps256(column4), column4, 1);
+
+        for (; i + 2 <= count; i += 2)
+        {
+            __m256 v = _mm256_loadu_ps(source[i].Data());
+            __m256 result = _mm256_mul_ps(columns1, _mm256_permute_ps(v, _MM_SHUFFLE(0, 0, 0, 0)));
+            result = _mm256_add_ps(result, _mm256_mul_ps(columns2, _mm256_permute_ps(v, _MM_SHUFFLE(1, 1, 1, 1))));
+            result = _mm256_add_ps(result, _mm256_mul_ps(columns3, _mm256_permute_ps(v, _MM_SHUFFLE(2, 2, 2, 2))));
+            result = _mm256_add_ps(result, _mm256_mul_ps(columns4, _mm256_permute_ps(v, _MM_SHUFFLE(3, 3, 3, 3))));
+            _mm256_storeu_ps(destination[i].Data(), result);
+        }
+#endif
+
+        for (; i < count; ++i)
+        {
+            __m128 v = _mm_loadu_ps(source[i].Data());
+            __m128 result = _mm_mul_ps(column1, _mm_shuffle_ps(v, v, _MM_SHUFFLE(0, 0, 0, 0)));
+            result = _mm_add_ps(result, _mm_mul_ps(column2, _mm_shuffle_ps(v, v, _MM_SHUFFLE(1, 1, 1, 1))));
+            result = _mm_add_ps(result, _mm_mul_ps(column3, _mm_shuffle_ps(v, v, _MM_SHUFFLE(2, 2, 2, 2))));
+            result = _mm_add_ps(result, _mm_mul_ps(column4, _mm_shuffle_ps(v, v, _MM_SHUFFLE(3, 3, 3, 3))));
+            _mm_storeu_ps(destination[i].Data(), result);
+        }
+#elif defined(FACE_ENGINE_NEON)
+        for (; i + 4 <= count; i += 4)
+        {
+            float32x4x4_t v = vld4q_f32(source[i].Data());
+            float32x4x4_t result;
+
+            for (int row = 0; row < 4; ++row)
+            {
+                const float* m = &Elements[row * 4];
+                result.val[row] = vmlaq_n_f32(vmlaq_n_f32(vmlaq_n_f32(vmulq_n_f32(v.val[0], m[0]), v.val[1], m[1]), v.val[2], m[2]), v.val[3], m[3]);
+            }
+
+            vst4q_f32(destination[i].Data(), result);
+        }
+#endif
+
+        for (; i < count; ++i)
+        {
+            Vector4f vector = source[i];
+            Transform(vector);
+            destination[i] = vector;
+        }
+    }
+
+    void Matrix4f::TransformBounds(const Rectanglef* source, Rectanglef* destination, std::size_t count) const noexcept
+    {
+        FaceEngine::TransformBounds(Affine2D { M11, M12, M14, M21, M22, M24 }, source, destination, count);
+    }
+}
\ No newline at end of file
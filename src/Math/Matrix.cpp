@@ -1,9 +0,0 @@
-#include "FaceEngine/Math/Matrix.h"
-
-namespace FaceEngine
-{
-    const std::vector<float> Matrix::ToArray() const noexcept
-    {
-        return std::vector<float>();
-    }
-}
\ No newline at end of file
@@ -1,126 +1,149 @@
 #include "FaceEngine/Math/Matrix4f.h"
 #include "FaceEngine/Math/Matrix3f.h"
+#include "FaceEngine/Math/SIMD.h"
 #include <cmath>
 
 namespace FaceEngine
 {
-    const Matrix4f Matrix4f::Zero = Matrix4f(0, 0, 0, 0, 
-                                             0, 0, 0, 0, 
-                                             0, 0, 0, 0, 
-                                             0, 0, 0, 0);
-    const Matrix4f Matrix4f::Identity = Matrix4f(1, 0, 0, 0,
-                                                 0, 1, 0, 0,
-                                                 0, 0, 1, 0,
-                                                 0, 0, 0, 1);
-
-    Matrix4f::Matrix4f() noexcept
-    {
-        M11 = 0;
-        M12 = 0;
-        M13 = 0;
-        M14 = 0;
-        M21 = 0;
-        M22 = 0;
-        M23 = 0;
-        M24 = 0;
-        M31 = 0;
-        M32 = 0;
-        M33 = 0;
-        M34 = 0;
-        M41 = 0;
-        M42 = 0;
-        M43 = 0;
-        M44 = 0;
-    }
-
-    Matrix4f::Matrix4f(const Matrix4f& matrix) noexcept
-    {
-        M11 = matrix.M11;
-        M12 = matrix.M12;
-        M13 = matrix.M13;
-        M14 = matrix.M14;
-        M21 = matrix.M21;
-        M22 = matrix.M22;
-        M23 = matrix.M23;
-        M24 = matrix.M24;
-        M31 = matrix.M31;
-        M32 = matrix.M32;
-        M33 = matrix.M33;
-        M34 = matrix.M34;
-        M41 = matrix.M41;
-        M42 = matrix.M42;
-        M43 = matrix.M43;
-        M44 = matrix.M44;
-    }
-
-    Matrix4f::Matrix4f(const float m11, const float m12, const float m13, const float m14, 
-                       const float m21, const float m22, const float m23, const float m24, 
-                       const float m31, const float m32, const float m33, const float m34, 
-                       const float m41, const float m42, const float m43, const float m44) noexcept
-    {
-        M11 = m11;
-        M12 = m12;
-        M13 = m13;
-        M14 = m14;
-        M21 = m21;
-        M22 = m22;
-        M23 = m23;
-        M24 = m24;
-        M31 = m31;
-        M32 = m32;
-        M33 = m33;
-        M34 = m34;
-        M41 = m41;
-        M42 = m42;
-        M43 = m43;
-        M44 = m44;
-    }
-
-    Matrix4f::Matrix4f(const Vector3f& rightVector, const Vector3f& upVector, const Vector3f& forwardVector, const Vector3f& translation) noexcept
-    {
-        M11 = rightVector.X;
-        M21 = rightVector.Y;
-        M31 = rightVector.Z;
-        
-        M12 = upVector.X;
-        M22 = upVector.Y;
-        M32 = upVector.Z;
-
-        M13 = forwardVector.X;
-        M23 = forwardVector.Y;
-        M33 = forwardVector.Z;
-
-        M14 = translation.X;
-        M24 = translation.Y;
-        M34 = translation.Z;
-
-        M41 = 0;
-        M42 = 0;
-        M43 = 0;
-        M44 = 1;
+    namespace
+    {
+#if defined(FACE_ENGINE_SSE)
+        // lanes are listed from the first element to the last, unlike _MM_SHUFFLE
+        template <int X, int Y, int Z, int W>
+        inline __m128 Swizzle(__m128 v) noexcept
+        {
+            return _mm_shuffle_ps(v, v, _MM_SHUFFLE(W, Z, Y, X));
+        }
+
+        inline float Dot(__m128 a, __m128 b) noexcept
+        {
+            __m128 product = _mm_mul_ps(a, b);
+            product = _mm_add_ps(product, _mm_movehl_ps(product, product));
+            product = _mm_add_ss(product, Swizzle<1, 1, 1, 1>(product));
+            return _mm_cvtss_f32(product);
+        }
+
+        /*
+         * The inverse is the adjugate divided by the determinant, and the adjugate is built from the determinants of the 2x2 minors of pairs of rows.
+         * Minors2x2 returns the 2x2 determinants of rows a and b in the three orders needed to expand the cofactors of one of the other two rows,
+         * and AdjugateColumn does the expansion; the sign of alternate elements still has to be flipped.
+         */
+        inline void Minors2x2(__m128 a, __m128 b, __m128& first, __m128& second, __m128& third) noexcept
+        {
+            __m128 a2211 = Swizzle<2, 2, 1, 1>(a);
+            __m128 a3332 = Swizzle<3, 3, 3, 2>(a);
+            __m128 a1000 = Swizzle<1, 0, 0, 0>(a);
+            __m128 b2211 = Swizzle<2, 2, 1, 1>(b);
+            __m128 b3332 = Swizzle<3, 3, 3, 2>(b);
+            __m128 b1000 = Swizzle<1, 0, 0, 0>(b);
+
+            first = _mm_sub_ps(_mm_mul_ps(a2211, b3332), _mm_mul_ps(b2211, a3332));
+            second = _mm_sub_ps(_mm_mul_ps(a1000, b3332), _mm_mul_ps(b1000, a3332));
+            third = _mm_sub_ps(_mm_mul_ps(a1000, b2211), _mm_mul_ps(b1000, a2211));
+        }
+
+        inline __m128 AdjugateColumn(__m128 row, __m128 first, __m128 second, __m128 third) noexcept
+        {
+            __m128 column = _mm_mul_ps(Swizzle<1, 0, 0, 0>(row), first);
+            column = _mm_sub_ps(column, _mm_mul_ps(Swizzle<2, 2, 1, 1>(row), second));
+            return _mm_add_ps(column, _mm_mul_ps(Swizzle<3, 3, 3, 2>(row), third));
+        }
+
+        // transforms a vector by the rows of a matrix, returning the results in the first four lanes
+        inline __m128 TransformRows(__m128 row1, __m128 row2, __m128 row3, __m128 row4, __m128 vector) noexcept
+        {
+            row1 = _mm_mul_ps(row1, vector);
+            row2 = _mm_mul_ps(row2, vector);
+            row3 = _mm_mul_ps(row3, vector);
+            row4 = _mm_mul_ps(row4, vector);
+            _MM_TRANSPOSE4_PS(row1, row2, row3, row4);
+            return _mm_add_ps(_mm_add_ps(row1, row2), _mm_add_ps(row3, row4));
+        }
+#endif
     }
 
     float Matrix4f::GetDeterminant() const noexcept
     {
-        return M11 * (M22 * (M33 * M44 - M34 * M43) - M23 * (M32 * M44 - M34 * M42) + M24 * (M32 * M43 - M33 * M42))
-                    - M12 * (M21 * (M33 * M44 - M34 * M43) - M23 * (M31 * M44 - M34 * M41) + M24 * (M31 * M43 - M33 * M41))
-                    + M13 * (M21 * (M32 * M44 - M34 * M42) - M22 * (M31 * M44 - M34 * M41) + M24 * (M31 * M42 - M32 * M41))
-                    - M14 * (M21 * (M33 * M43 - M32 * M42) - M22 * (M31 * M43 - M32 * M41) + M23 * (M31 * M43 - M33 * M41));
+#if defined(FACE_ENGINE_SSE)
+        __m128 first, second, third;
+        Minors2x2(_mm_load_ps(&Elements[8]), _mm_load_ps(&Elements[12]), first, second, third);
+        __m128 column = AdjugateColumn(_mm_load_ps(&Elements[4]), first, second, third);
+        return Dot(_mm_mul_ps(_mm_load_ps(&Elements[0]), _mm_setr_ps(1.0f, -1.0f, 1.0f, -1.0f)), column);
+#else
+        // expansion by the 2x2 minors of the first two and last two rows
+        return (M11 * M22 - M21 * M12) * (M33 * M44 - M43 * M34) - (M11 * M23 - M21 * M13) * (M32 * M44 - M42 * M34)
+             + (M11 * M24 - M21 * M14) * (M32 * M43 - M42 * M33) + (M12 * M23 - M22 * M13) * (M31 * M44 - M41 * M34)
+             - (M12 * M24 - M22 * M14) * (M31 * M43 - M41 * M33) + (M13 * M24 - M23 * M14) * (M31 * M42 - M41 * M32);
+#endif
     }
 
     Matrix4f Matrix4f::GetInverse() const
     {
-        Matrix4f adjoint = GetAdjoint();
-        float determinant = GetDeterminant();
+        Matrix4f inverse;
+
+#if defined(FACE_ENGINE_SSE)
+        __m128 row1 = _mm_load_ps(&Elements[0]);
+        __m128 row2 = _mm_load_ps(&Elements[4]);
+        __m128 row3 = _mm_load_ps(&Elements[8]);
+        __m128 row4 = _mm_load_ps(&Elements[12]);
+        __m128 signs = _mm_setr_ps(1.0f, -1.0f, 1.0f, -1.0f);
+        __m128 negatedSigns = _mm_setr_ps(-1.0f, 1.0f, -1.0f, 1.0f);
+        __m128 first, second, third;
+
+        Minors2x2(row3, row4, first, second, third);
+        __m128 column1 = _mm_mul_ps(AdjugateColumn(row2, first, second, third), signs);
+        __m128 column2 = _mm_mul_ps(AdjugateColumn(row1, first, second, third), negatedSigns);
+        Minors2x2(row1, row2, first, second, third);
+        __m128 column3 = _mm_mul_ps(AdjugateColumn(row4, first, second, third), signs);
+        __m128 column4 = _mm_mul_ps(AdjugateColumn(row3, first, second, third), negatedSigns);
+
+        float determinant = Dot(row1, column1);
 
         if (determinant == 0)
         {
             throw Exception::FromMessage("Matrix4f::GetInverse()", "Matrix4f is not invertible as the determinant is zero.");
         }
 
-        adjoint *= 1 / determinant;
+        __m128 scale = _mm_set1_ps(1 / determinant);
+        column1 = _mm_mul_ps(column1, scale);
+        column2 = _mm_mul_ps(column2, scale);
+        column3 = _mm_mul_ps(column3, scale);
+        column4 = _mm_mul_ps(column4, scale);
+        _MM_TRANSPOSE4_PS(column1, column2, column3, column4);
+
+        _mm_store_ps(&inverse.Elements[0], column1);
+        _mm_store_ps(&inverse.Elements[4], column2);
+        _mm_store_ps(&inverse.Elements[8], column3);
+        _mm_store_ps(&inverse.Elements[12], column4);
+#else
+        // 2x2 minors of the first two rows (s) and the last two rows (c), each used by six cofactors
+        float s0 = M11 * M22 - M21 * M12;
+        float s1 = M11 * M23 - M21 * M13;
+        float s2 = M11 * M24 - M21 * M14;
+        float s3 = M12 * M23 - M22 * M13;
+        float s4 = M12 * M24 - M22 * M14;
+        float s5 = M13 * M24 - M23 * M14;
+        float c0 = M31 * M42 - M41 * M32;
+        float c1 = M31 * M43 - M41 * M33;
+        float c2 = M31 * M44 - M41 * M34;
+        float c3 = M32 * M43 - M42 * M33;
+        float c4 = M32 * M44 - M42 * M34;
+        float c5 = M33 * M44 - M43 * M34;
+        float determinant = s0 * c5 - s1 * c4 + s2 * c3 + s3 * c2 - s4 * c1 + s5 * c0;
 
-        return adjoint;
+        if (determinant == 0)
+        {
+            throw Exception::FromMessage("Matrix4f::GetInverse()", "Matrix4f is not invertible as the determinant is zero.");
+        }
+
+        inverse = Matrix4f( M22 * c5 - M23 * c4 + M24 * c3, -M12 * c5 + M13 * c4 - M14 * c3,  M42 * s5 - M43 * s4 + M44 * s3, -M32 * s5 + M33 * s4 - M34 * s3,
+                           -M21 * c5 + M23 * c2 - M24 * c1,  M11 * c5 - M13 * c2 + M14 * c1, -M41 * s5 + M43 * s2 - M44 * s1,  M31 * s5 - M33 * s2 + M34 * s1,
+                            M21 * c4 - M22 * c2 + M24 * c0, -M11 * c4 + M12 * c2 - M14 * c0,  M41 * s4 - M42 * s2 + M44 * s0, -M31 * s4 + M32 * s2 - M34 * s0,
+                           -M21 * c3 + M22 * c1 - M23 * c0,  M11 * c3 - M12 * c1 + M13 * c0, -M41 * s3 + M42 * s1 - M43 * s0,  M31 * s3 - M32 * s1 + M33 * s0);
+        inverse.Multiply(1 / determinant);
+#endif
+
+        return inverse;
     }
 
     Matrix4f Matrix4f::GetMinors() const noexcept
@@ -128,7 +151,7 @@ namespace FaceEngine
         Matrix4f minors;
 
         minors.M11 = Matrix3f(M22, M23, M24, M32, M33, M34, M42, M43, M44).GetDeterminant();
-        minors.M12 = Matrix3f(M21, M23, M24, M31, M33, M34, M41, M43, M33).GetDeterminant();
+        minors.M12 = Matrix3f(M21, M23, M24, M31, M33, M34, M41, M43, M44).GetDeterminant();
         minors.M13 = Matrix3f(M21, M22, M24, M31, M32, M34, M41, M42, M44).GetDeterminant();
         minors.M14 = Matrix3f(M21, M22, M23, M31, M32, M33, M41, M42, M43).GetDeterminant();
         minors.M21 = Matrix3f(M12, M13, M14, M32, M33, M34, M42, M43, M44).GetDeterminant();
@@ -181,6 +204,24 @@ namespace FaceEngine
 
     void Matrix4f::Transpose() noexcept
     {
+#if defined(FACE_ENGINE_SSE)
+        __m128 row1 = _mm_load_ps(&Elements[0]);
+        __m128 row2 = _mm_load_ps(&Elements[4]);
+        __m128 row3 = _mm_load_ps(&Elements[8]);
+        __m128 row4 = _mm_load_ps(&Elements[12]);
+        _MM_TRANSPOSE4_PS(row1, row2, row3, row4);
+        _mm_store_ps(&Elements[0], row1);
+        _mm_store_ps(&Elements[4], row2);
+        _mm_store_ps(&Elements[8], row3);
+        _mm_store_ps(&Elements[12], row4);
+#elif defined(FACE_ENGINE_NEON)
+        // de-interleaving every fourth element loads the columns
+        float32x4x4_t columns = vld4q_f32(Elements);
+        vst1q_f32(&Elements[0], columns.val[0]);
+        vst1q_f32(&Elements[4], columns.val[1]);
+        vst1q_f32(&Elements[8], columns.val[2]);
+        vst1q_f32(&Elements[12], columns.val[3]);
+#else
         float tempM12 = M12;
         float tempM13 = M13;
         float tempM14 = M14;
@@ -201,6 +242,7 @@ namespace FaceEngine
         M32 = tempM23;
         M42 = tempM24;
         M43 = tempM34;
+#endif
     }
 
     void Matrix4f::Add(const Matrix4f& matrix) noexcept
@@ -245,40 +287,91 @@ namespace FaceEngine
 
     void Matrix4f::Multiply(const Matrix4f& matrix) noexcept
     {
-        Matrix4f original = Matrix4f(*this);
-
-        M11 = original.M11 * matrix.M11 + original.M12 * matrix.M21 + original.M13 * matrix.M31
-                    + original.M14 * matrix.M41;
-        M12 = original.M11 * matrix.M12 + original.M12 * matrix.M22 + original.M13 * matrix.M32
-                + original.M14 * matrix.M42;
-        M13 = original.M11 * matrix.M13 + original.M12 * matrix.M23 + original.M13 * matrix.M33
-                + original.M14 * matrix.M43;
-        M14 = original.M11 * matrix.M14 + original.M12 * matrix.M24 + original.M13 * matrix.M34
-                + original.M14 * matrix.M44;
-        M21 = original.M21 * matrix.M11 + original.M22 * matrix.M21 + original.M23 * matrix.M31
-                + original.M24 * matrix.M41;
-        M22 = original.M21 * matrix.M12 + original.M22 * matrix.M22 + original.M23 * matrix.M32
-                + original.M24 * matrix.M42;
-        M23 = original.M21 * matrix.M13 + original.M22 * matrix.M23 + original.M23 * matrix.M33
-                + original.M24 * matrix.M43;
-        M24 = original.M21 * matrix.M14 + original.M22 * matrix.M24 + original.M23 * matrix.M34
-                + original.M24 * matrix.M44;
-        M31 = original.M31 * matrix.M11 + original.M32 * matrix.M21 + original.M33 * matrix.M31
-                + original.M34 * matrix.M41;
-        M32 = original.M31 * matrix.M12 + original.M32 * matrix.M22 + original.M33 * matrix.M32
-                + original.M34 * matrix.M42;
-        M33 = original.M31 * matrix.M13 + original.M32 * matrix.M23 + original.M33 * matrix.M33
-                + original.M34 * matrix.M43;
-        M34 = original.M31 * matrix.M14 + original.M32 * matrix.M24 + original.M33 * matrix.M34
-                + original.M34 * matrix.M44;
-        M41 = original.M41 * matrix.M11 + original.M42 * matrix.M21 + original.M43 * matrix.M31
-                + original.M44 * matrix.M41;
-        M42 = original.M41 * matrix.M12 + original.M42 * matrix.M22 + original.M43 * matrix.M32
-                + original.M44 * matrix.M42;
-        M43 = original.M41 * matrix.M13 + original.M42 * matrix.M23 + original.M43 * matrix.M33
-                + original.M44 * matrix.M43;
-        M44 = original.M41 * matrix.M14 + original.M42 * matrix.M24 + original.M43 * matrix.M34
-                + original.M44 * matrix.M44;
+        // each row of the product is the rows of the other matrix weighted by the elements of the same row of this one
+#if defined(FACE_ENGINE_AVX)
+        // two rows of the product at a time, with each row of the other matrix repeated in both halves
+        __m256 other1 = _mm256_broadcast_ps((const __m128*)&matrix.Elements[0]);
+        __m256 other2 = _mm256_broadcast_ps((const __m128*)&matrix.Elements[4]);
+        __m256 other3 = _mm256_broadcast_ps((const __m128*)&matrix.Elements[8]);
+        __m256 other4 = _mm256_broadcast_ps((const __m128*)&matrix.Elements[12]);
+        __m256 rows[2] = { _mm256_loadu_ps(&Elements[0]), _mm256_loadu_ps(&Elements[8]) };
+
+        for (int i = 0; i < 2; ++i)
+        {
+            __m256 row = _mm256_mul_ps(_mm256_shuffle_ps(rows[i], rows[i], 0x00), other1);
+            row = _mm256_add_ps(row, _mm256_mul_ps(_mm256_shuffle_ps(rows[i], rows[i], 0x55), other2));
+            row = _mm256_add_ps(row, _mm256_mul_ps(_mm256_shuffle_ps(rows[i], rows[i], 0xAA), other3));
+            row = _mm256_add_ps(row, _mm256_mul_ps(_mm256_shuffle_ps(rows[i], rows[i], 0xFF), other4));
+            _mm256_storeu_ps(&Elements[i * 8], row);
+        }
+#elif defined(FACE_ENGINE_SSE)
+        __m128 other1 = _mm_load_ps(&matrix.Elements[0]);
+        __m128 other2 = _mm_load_ps(&matrix.Elements[4]);
+        __m128 other3 = _mm_load_ps(&matrix.Elements[8]);
+        __m128 other4 = _mm_load_ps(&matrix.Elements[12]);
+
+        for (int i = 0; i < 16; i += 4)
+        {
+            __m128 original = _mm_load_ps(&Elements[i]);
+            __m128 row = _mm_mul_ps(Swizzle<0, 0, 0, 0>(original), other1);
+            row = _mm_add_ps(row, _mm_mul_ps(Swizzle<1, 1, 1, 1>(original), other2));
+            row = _mm_add_ps(row, _mm_mul_ps(Swizzle<2, 2, 2, 2>(original), other3));
+            row = _mm_add_ps(row, _mm_mul_ps(Swizzle<3, 3, 3, 3>(original), other4));
+            _mm_store_ps(&Elements[i], row);
+        }
+#elif defined(FACE_ENGINE_NEON)
+        float32x4_t other1 = vld1q_f32(&matrix.Elements[0]);
+        float32x4_t other2 = vld1q_f32(&matrix.Elements[4]);
+        float32x4_t other3 = vld1q_f32(&matrix.Elements[8]);
+        float32x4_t other4 = vld1q_f32(&matrix.Elements[12]);
+
+        for (int i = 0; i < 16; i += 4)
+        {
+            float32x4_t row = vmulq_n_f32(other1, Elements[i]);
+            row = vmlaq_n_f32(row, other2, Elements[i + 1]);
+            row = vmlaq_n_f32(row, other3, Elements[i + 2]);
+            row = vmlaq_n_f32(row, other4, Elements[i + 3]);
+            vst1q_f32(&Elements[i], row);
+        }
+#else
+        // the product is built in a copy as the other matrix may be this one
+        Matrix4f product;
+
+        product.M11 = M11 * matrix.M11 + M12 * matrix.M21 + M13 * matrix.M31
+                    + M14 * matrix.M41;
+        product.M12 = M11 * matrix.M12 + M12 * matrix.M22 + M13 * matrix.M32
+                + M14 * matrix.M42;
+        product.M13 = M11 * matrix.M13 + M12 * matrix.M23 + M13 * matrix.M33
+                + M14 * matrix.M43;
+        product.M14 = M11 * matrix.M14 + M12 * matrix.M24 + M13 * matrix.M34
+                + M14 * matrix.M44;
+        product.M21 = M21 * matrix.M11 + M22 * matrix.M21 + M23 * matrix.M31
+                + M24 * matrix.M41;
+        product.M22 = M21 * matrix.M12 + M22 * matrix.M22 + M23 * matrix.M32
+                + M24 * matrix.M42;
+        product.M23 = M21 * matrix.M13 + M22 * matrix.M23 + M23 * matrix.M33
+                + M24 * matrix.M43;
+        product.M24 = M21 * matrix.M14 + M22 * matrix.M24 + M23 * matrix.M34
+                + M24 * matrix.M44;
+        product.M31 = M31 * matrix.M11 + M32 * matrix.M21 + M33 * matrix.M31
+                + M34 * matrix.M41;
+        product.M32 = M31 * matrix.M12 + M32 * matrix.M22 + M33 * matrix.M32
+                + M34 * matrix.M42;
+        product.M33 = M31 * matrix.M13 + M32 * matrix.M23 + M33 * matrix.M33
+                + M34 * matrix.M43;
+        product.M34 = M31 * matrix.M14 + M32 * matrix.M24 + M33 * matrix.M34
+                + M34 * matrix.M44;
+        product.M41 = M41 * matrix.M11 + M42 * matrix.M21 + M43 * matrix.M31
+                + M44 * matrix.M41;
+        product.M42 = M41 * matrix.M12 + M42 * matrix.M22 + M43 * matrix.M32
+                + M44 * matrix.M42;
+        product.M43 = M41 * matrix.M13 + M42 * matrix.M23 + M43 * matrix.M33
+                + M44 * matrix.M43;
+        product.M44 = M41 * matrix.M14 + M42 * matrix.M24 + M43 * matrix.M34
+                + M44 * matrix.M44;
+
+        *this = product;
+#endif
     }
 
     void Matrix4f::Multiply(const float scalar) noexcept
@@ -328,6 +421,7 @@ namespace FaceEngine
 
     void Matrix4f::Transform(Vector3f& vector) const noexcept
     {
+        // left scalar, as summing across SIMD lanes costs more than the three dot products
         float oldX = vector.X;
         float oldY = vector.Y;
 
@@ -338,6 +432,25 @@ namespace FaceEngine
 
     void Matrix4f::Transform(Vector4f& vector) const noexcept
     {
+#if defined(FACE_ENGINE_SSE)
+        alignas(16) float result[4];
+        _mm_store_ps(result, TransformRows(_mm_load_ps(&Elements[0]), _mm_load_ps(&Elements[4]), _mm_load_ps(&Elements[8]), _mm_load_ps(&Elements[12]),
+                                           _mm_setr_ps(vector.X, vector.Y, vector.Z, vector.W)));
+        vector.X = result[0];
+        vector.Y = result[1];
+        vector.Z = result[2];
+        vector.W = result[3];
+#elif defined(FACE_ENGINE_NEON)
+        float32x4x4_t columns = vld4q_f32(Elements);
+        float32x4_t result = vmulq_n_f32(columns.val[0], vector.X);
+        result = vmlaq_n_f32(result, columns.val[1], vector.Y);
+        result = vmlaq_n_f32(result, columns.val[2], vector.Z);
+        result = vmlaq_n_f32(result, columns.val[3], vector.W);
+        vector.X = vgetq_lane_f32(result, 0);
+        vector.Y = vgetq_lane_f32(result, 1);
+        vector.Z = vgetq_lane_f32(result, 2);
+        vector.W = vgetq_lane_f32(result, 3);
+#else
         float oldX = vector.X;
         float oldY = vector.Y;
         float oldZ = vector.Z;
@@ -345,81 +458,8 @@ namespace FaceEngine
         vector.X = vector.X * M11 + vector.Y * M12 + vector.Z * M13 + vector.W * M14;
         vector.Y = oldX * M21 + vector.Y * M22 + vector.Z * M23 + vector.W * M24;
         vector.Z = oldX * M31 + oldY * M32 + vector.Z * M33 + vector.W * M34;
-        vector.W = oldZ * M41 + oldY * M42 + oldZ * M43 + vector.W * M44;
-    }
-
-    void Matrix4f::SetRight(const Vector3f& rightVector) noexcept
-    {
-        M11 = rightVector.X;
-        M21 = rightVector.Y;
-        M31 = rightVector.Z;
-    }
-
-    void Matrix4f::SetUp(const Vector3f& upVector) noexcept
-    {
-        M12 = upVector.X;
-        M22 = upVector.Y;
-        M32 = upVector.Z;
-    }
-
-    void Matrix4f::SetForward(const Vector3f& forwardVector) noexcept
-    {
-        M13 = forwardVector.X;
-        M23 = forwardVector.Y;
-        M33 = forwardVector.Z;
-    }
-
-    void Matrix4f::SetTranslation(const float translationX, const float translationY, const float translationZ) noexcept
-    {
-        M14 = translationX;
-        M24 = translationY;
-        M34 = translationZ;
-    }
-
-    void Matrix4f::SetTranslation(const Vector3f& translation) noexcept
-    {
-        M14 = translation.X;
-        M24 = translation.Y;
-        M34 = translation.Z;
-    }
-
-    void Matrix4f::SetScale(const float scale) noexcept
-    {
-        M11 = scale;
-        M22 = scale;
-        M33 = scale;
-    }
-
-    void Matrix4f::SetScale(const float scaleX, const float scaleY, const float scaleZ) noexcept
-    {
-        M11 = scaleX;
-        M22 = scaleY;
-        M33 = scaleZ;
-    }
-
-    Vector3f Matrix4f::GetRight() const noexcept
-    {
-        return Vector3f(M11, M21, M31);
-    }
-
-    Vector3f Matrix4f::GetUp() const noexcept
-    {
-        return Vector3f(M21, M22, M23);
-    }
-
-    Vector3f Matrix4f::GetForward() const noexcept
-    {
-        return Vector3f(M31, M32, M33);
-    }
-    
-    Vector3f Matrix4f::GetTranslation() const noexcept
-    {
-        return Vector3f(M14, M24, M34);
-    }
-
-    Vector3f Matrix4f::GetScale() const noexcept
-    {
-        return Vector3f(M11, M22, M33);
+        vector.W = oldX * M41 + oldY * M42 + oldZ * M43 + vector.W * M44;
+#endif
     }
 
     Matrix4f Matrix4f::CreateBillboard(Vector3f& objectPos, Vector3f& cameraPos, Vector3f& upVector, Vector3f& forwardVector) noexcept
@@ -494,14 +534,6 @@ namespace FaceEngine
         return matrix;
     }
 
-    Matrix4f Matrix4f::CreateOrthographic(const float width, const float height, const float zNearPlane, const float zFarPlane) noexcept
-    {
-        return Matrix4f(2 / width, 0, 0, 0,
-                        0, 2 / height, 0, 0,
-                        0, 0, 1, 0,
-                        0, 0, 0, 1);
-    }
-
     Matrix4f Matrix4f::CreateOrthographicOffCentre(const float left, const float right, const float bottom, const float top, const float zNearPlane, const float zFarPlane) noexcept
     {
         // TODO: implement
@@ -528,16 +560,6 @@ namespace FaceEngine
         return Identity;
     }
 
-    Matrix4f Matrix4f::CreateWorld(const Vector3f& objectPos, const Vector3f& upVector, const Vector3f& forwardVector) noexcept
-    {
-        Vector3f rightVector = upVector.Cross(forwardVector);
-
-        return Matrix4f(rightVector.X, upVector.X, forwardVector.X, objectPos.X,
-                        rightVector.Y, upVector.Y, forwardVector.Y, objectPos.Y,
-                        rightVector.Z, upVector.Z, forwardVector.Z, objectPos.Z,
-                        0, 0, 0, 1);
-    }
-
     Matrix4f Matrix4f::CreateRotationX(const float angle) noexcept
     {
         return Matrix4f(1, 0, 0, 0, 0, cos(angle), -sin(angle), 0, 0, sin(angle), cos(angle), 0, 0, 0, 0, 1);
@@ -571,26 +593,6 @@ namespace FaceEngine
         return Identity;
     }
     
-    Matrix4f Matrix4f::CreateScale(const float scale) noexcept
-    {
-        return Matrix4f(scale, 0, 0, 0, 0, scale, 0, 0, 0, 0, scale, 0, 0, 0, 0, 1);
-    }
-
-    Matrix4f Matrix4f::CreateScale(const float scaleX, const float scaleY, const float scaleZ) noexcept
-    {
-        return Matrix4f(scaleX, 0, 0, 0, 0, scaleY, 0, 0, 0, 0, scaleZ, 0, 0, 0, 0, 1);
-    }
-
-    Matrix4f Matrix4f::CreateTranslation(const float translationX, const float translationY, const float translationZ) noexcept
-    {
-        return Matrix4f(1, 0, 0, translationX, 0, 1, 0, translationY, 0, 0, 1, translationZ, 0, 0, 0, 1);
-    }
-
-    Matrix4f Matrix4f::CreateTranslation(const Vector3f& translation) noexcept
-    {
-        return Matrix4f(1, 0, 0, translation.X, 0, 1, 0, translation.Y, 0, 0, 1, translation.Z, 0, 0, 0, 1);
-    }
-
     Matrix4f Matrix4f::Lerp(const Matrix4f& firstMatrix, const Matrix4f& secondMatrix, const float t) noexcept
     {
         // TODO: implement (https://stackoverflow.com/questions/27751602/interpolation-between-2-4x4-matrices)
@@ -660,26 +662,7 @@ namespace FaceEngine
             throw Exception::FromMessage("Matrix4f::operator[](int)", "Index out of bounds of Matrix4f.");
         }
 
-        switch (index)
-        {
-            case 0: return M11;
-            case 1: return M12;
-            case 2: return M13;
-            case 3: return M14;
-            case 4: return M21;
-            case 5: return M22;
-            case 6: return M23;
-            case 7: return M24;
-            case 8: return M31;
-            case 9: return M32;
-            case 10: return M33;
-            case 11: return M34;
-            case 12: return M41;
-            case 13: return M42;
-            case 14: return M43;
-            case 15: return M44;
-            default: return 0.0f;
-        }
+        return Elements[index];
     }
 
     float& Matrix4f::operator [](int index)
@@ -689,26 +672,7 @@ namespace FaceEngine
             throw Exception::FromMessage("Matrix4f::operator[](int)", "Index out of bounds of Matrix4f.");
         }
 
-        switch (index)
-        {
-            case 0: return M11;
-            case 1: return M12;
-            case 2: return M13;
-            case 3: return M14;
-            case 4: return M21;
-            case 5: return M22;
-            case 6: return M23;
-            case 7: return M24;
-            case 8: return M31;
-            case 9: return M32;
-            case 10: return M33;
-            case 11: return M34;
-            case 12: return M41;
-            case 13: return M42;
-            case 14: return M43;
-            case 15: return M44;
-            default: return M11;
-        }
+        return Elements[index];
     }
 }
 
@@ -735,50 +699,32 @@ FaceEngine::Matrix4f operator *(const FaceEngine::Matrix4f& firstMatrix, const F
 
 FaceEngine::Vector3f operator *(const FaceEngine::Matrix4f& matrix, const FaceEngine::Vector3f& vector) noexcept
 {
-    return FaceEngine::Vector3f(vector.X * matrix.M11 + vector.Y * matrix.M12 + vector.Z * matrix.M13 + matrix.M14,
-                                vector.X * matrix.M21 + vector.Y * matrix.M22 + vector.Z * matrix.M23 + matrix.M24,
-                                vector.X * matrix.M31 + vector.Y * matrix.M32 + vector.Z * matrix.M33 + matrix.M34);
+    FaceEngine::Vector3f result = vector;
+    matrix.Transform(result);
+    return result;
 }
 
 FaceEngine::Vector4f operator *(const FaceEngine::Matrix4f& matrix, const FaceEngine::Vector4f& vector) noexcept
 {
-    return FaceEngine::Vector4f(vector.X * matrix.M11 + vector.Y * matrix.M12 + vector.Z * matrix.M13 + vector.W * matrix.M14,
-                                vector.X * matrix.M21 + vector.Y * matrix.M22 + vector.Z * matrix.M23 + vector.W * matrix.M24,
-                                vector.X * matrix.M31 + vector.Y * matrix.M32 + vector.Z * matrix.M33 + vector.W * matrix.M34,
-                                vector.X * matrix.M41 + vector.Y * matrix.M42 + vector.Z * matrix.M43 + vector.W * matrix.M44);
+    FaceEngine::Vector4f result = vector;
+    matrix.Transform(result);
+    return result;
 }
 
-FaceEngine::Matrix4f operator *(const FaceEngine::Matrix4f& firstMatrix, const float& scalar) noexcept
+FaceEngine::Matrix4f operator *(const FaceEngine::Matrix4f& firstMatrix, const float scalar) noexcept
 {
     FaceEngine::Matrix4f result = FaceEngine::Matrix4f(firstMatrix);
     result.Multiply(scalar);
     return result;
 }
 
-FaceEngine::Matrix4f operator /(const FaceEngine::Matrix4f& firstMatrix, const float& scalar)
+FaceEngine::Matrix4f operator /(const FaceEngine::Matrix4f& firstMatrix, const float scalar)
 {
     FaceEngine::Matrix4f result = FaceEngine::Matrix4f(firstMatrix);
     result.Divide(scalar);
     return result;
 }
 
-bool operator ==(const FaceEngine::Matrix4f& firstMatrix, const FaceEngine::Matrix4f& secondMatrix) noexcept
-{
-    return firstMatrix.M11 == secondMatrix.M11 && firstMatrix.M12 == secondMatrix.M12 &&
-           firstMatrix.M13 == secondMatrix.M13 && firstMatrix.M14 == secondMatrix.M14 &&
-           firstMatrix.M21 == secondMatrix.M21 && firstMatrix.M22 == secondMatrix.M22 &&
-           firstMatrix.M23 == secondMatrix.M23 && firstMatrix.M24 == secondMatrix.M24 &&
-           firstMatrix.M31 == secondMatrix.M31 && firstMatrix.M32 == secondMatrix.M32 &&
-           firstMatrix.M33 == secondMatrix.M33 && firstMatrix.M34 == secondMatrix.M34 &&
-           firstMatrix.M41 == secondMatrix.M41 && firstMatrix.M42 == secondMatrix.M42 &&
-           firstMatrix.M43 == secondMatrix.M43 && firstMatrix.M44 == secondMatrix.M44;
-}
-
-bool operator !=(const FaceEngine::Matrix4f& firstMatrix, const FaceEngine::Matrix4f& secondMatrix) noexcept
-{
-    return !(firstMatrix == secondMatrix);
-}
-
 std::ostream& operator <<(std::ostream& cout, const FaceEngine::Matrix4f& matrix) noexcept
 {
     cout << matrix.ToStringInline();
@@ -1,9 +0,0 @@
-#include "FaceEngine/Math/Vector.h"
-
-namespace FaceEngine
-{
-    const std::vector<float> Vector::ToArray() const noexcept
-    {
-        return std::vector<float>();
-    }
-}
\ No newline at end of file
@@ -0,0 +1,219 @@
+#include <chrono>
+#include <cstdio>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "FaceEngine/Profiler.h"
+#include "FaceEngine/Exception.h"
+#include "FaceEngine/JSON.h"
+
+namespace FaceEngine
+{
+    namespace
+    {
+        struct ProfileEvent
+        {
+            const char* Name;
+            std::uint64_t Start;
+            std::uint64_t End;
+        };
+
+        // a single-producer single-consumer ring: the owning thread records, exports read
+        struct ThreadBuffer
+        {
+            std::uint32_t Id;
+            std::string Name;
+            // recorded on by name rather than by a thread
+            bool Track = false;
+            std::vector<ProfileEvent> Events;
+            std::atomic_uint64_t Head { 0 };
+            std::atomic_uint64_t Tail { 0 };
+            std::atomic_size_t Dropped { 0 };
+        };
+
+        const std::chrono::steady_clock::time_point Epoch = std::chrono::steady_clock::now();
+
+        std::mutex& GetBuffersMutex() noexcept
+        {
+            static std::mutex buffersMutex;
+            return buffersMutex;
+        }
+
+        // buffers are never freed, as events from threads that have exited may not have been exported yet
+        std::vector<std::unique_ptr<ThreadBuffer>>& GetBuffers() noexcept
+        {
+            static std::vector<std::unique_ptr<ThreadBuffer>> buffers;
+            return buffers;
+        }
+
+        thread_local ThreadBuffer* CurrentBuffer = nullptr;
+
+        // must be called with the buffers mutex locked
+        ThreadBuffer* AddBuffer(const std::string& name)
+        {
+            std::unique_ptr<ThreadBuffer> buffer(new ThreadBuffer);
+            buffer->Id = GetBuffers().size() + 1;
+            buffer->Name = name.empty() ? "Thread " + std::to_string(buffer->Id) : name;
+            GetBuffers().push_back(std::move(buffer));
+            return GetBuffers().back().get();
+        }
+
+        ThreadBuffer* GetThreadBuffer()
+        {
+            if (CurrentBuffer == nullptr)
+            {
+                std::lock_guard<std::mutex> lock(GetBuffersMutex());
+                CurrentBuffer = AddBuffer(std::string());
+            }
+
+            return CurrentBuffer;
+        }
+
+        ThreadBuffer* GetTrackBuffer(const std::string& track)
+        {
+            std::lock_guard<std::mutex> lock(GetBuffersMutex());
+
+            for (const std::unique_ptr<ThreadBuffer>& buffer : GetBuffers())
+            {
+                if (buffer->Track && buffer->Name == track)
+                {
+                    return buffer.get();
+                }
+            }
+
+            ThreadBuffer* buffer = AddBuffer(track);
+            buffer->Track = true;
+            return buffer;
+        }
+
+        void Write(ThreadBuffer* buffer, const char* name, std::uint64_t start, std::uint64_t end)
+        {
+            // ring buffers are only allocated once something is recorded on them
+            if (buffer->Events.empty())
+            {
+                buffer->Events.resize(PROFILER_THREAD_EVENTS);
+            }
+
+            std::uint64_t head = buffer->Head.load(std::memory_order_relaxed);
+
+            if (head - buffer->Tail.load(std::memory_order_acquire) >= PROFILER_THREAD_EVENTS)
+            {
+                buffer->Dropped.fetch_add(1, std::memory_order_relaxed);
+                return;
+            }
+
+            buffer->Events[head % PROFILER_THREAD_EVENTS] = ProfileEvent { name, start, end };
+            buffer->Head.store(head + 1, std::memory_order_release);
+        }
+    }
+
+    std::atomic_bool Profiler::enabled(false);
+
+    std::uint64_t Profiler::Now() noexcept
+    {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - Epoch).count();
+    }
+
+    void Profiler::Record(const char* name, std::uint64_t start, std::uint64_t end) noexcept
+    {
+        try
+        {
+            Write(GetThreadBuffer(), name, start, end);
+        }
+        catch (...)
+        {
+            // recording is best effort, running out of memory for a ring buffer only loses events
+        }
+    }
+
+    void Profiler::RecordOnTrack(const std::string& track, const char* name, std::uint64_t start, std::uint64_t end) noexcept
+    {
+        try
+        {
+            Write(GetTrackBuffer(track), name, start, end);
+        }
+        catch (...)
+        {
+        }
+    }
+
+    void Profiler::SetThreadName(const std::string& name)
+    {
+        ThreadBuffer* buffer = GetThreadBuffer();
+        std::lock_guard<std::mutex> lock(GetBuffersMutex());
+        buffer->Name = name;
+    }
+
+    std::size_t Profiler::GetDroppedCount() noexcept
+    {
+        std::lock_guard<std::mutex> lock(GetBuffersMutex());
+        std::size_t dropped = 0;
+
+        for (const std::unique_ptr<ThreadBuffer>& buffer : GetBuffers())
+        {
+            dropped += buffer->Dropped.load(std::memory_order_relaxed);
+        }
+
+        return dropped;
+    }
+
+    void Profiler::Clear() noexcept
+    {
+        std::lock_guard<std::mutex> lock(GetBuffersMutex());
+
+        for (const std::unique_ptr<ThreadBuffer>& buffer : GetBuffers())
+        {
+            buffer->Tail.store(buffer->Head.load(std::memory_order_acquire), std::memory_order_release);
+            buffer->Dropped.store(0, std::memory_order_relaxed);
+        }
+    }
+
+    std::size_t Profiler::WriteChromeTrace(const std::string& path)
+    {
+        std::FILE* fp = std::fopen(path.c_str(), "wb");
+
+        if (!fp)
+        {
+            throw Exception::FromMessage("FaceEngine::Profiler::WriteChromeTrace", "Couldn't open file for writing.");
+        }
+
+        std::lock_guard<std::mutex> lock(GetBuffersMutex());
+        std::size_t count = 0;
+        bool first = true;
+        std::fputs("{\"displayTimeUnit\":\"ns\",\"traceEvents\":[", fp);
+
+        for (const std::unique_ptr<ThreadBuffer>& buffer : GetBuffers())
+        {
+            std::fprintf(fp, "%s{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%u,\"args\":{\"name\":\"%s\"}}",
+                first ? "" : ",", buffer->Id, EscapeJSON(buffer->Name).c_str());
+            first = false;
+
+            std::uint64_t head = buffer->Head.load(std::memory_order_acquire);
+            std::uint64_t tail = buffer->Tail.load(std::memory_order_relaxed);
+
+            for (; tail != head; ++tail, ++count)
+            {
+                const ProfileEvent& event = buffer->Events[tail % PROFILER_THREAD_EVENTS];
+
+                // complete events with microsecond timestamps
+                std::fprintf(fp, ",{\"name\":\"%s\",\"ph\":\"X\",\"pid\":1,\"tid\":%u,\"ts\":%.3f,\"dur\":%.3f}",
+                    EscapeJSON(event.Name).c_str(), buffer->Id, event.Start / 1000.0, (event.End - event.Start) / 1000.0);
+            }
+
+            buffer->Tail.store(head, std::memory_order_release);
+            buffer->Dropped.store(0, std::memory_order_relaxed);
+        }
+
+        std::fputs("]}", fp);
+        bool failed = std::ferror(fp);
+        std::fclose(fp);
+
+        if (failed)
+        {
+            throw Exception::FromMessage("FaceEngine::Profiler::WriteChromeTrace", "Couldn't write trace file.");
+        }
+
+        return count;
+    }
+}
\ No newline at end of file
@@ -5,4 +5,8 @@ namespace FaceEngine
     bool Resource::IsDisposed() noexcept { return true; }
 
     void Resource::Dispose() noexcept { }
+
+    std::size_t Resource::GetGPUMemorySize() const noexcept { return 0; }
+
+    std::size_t Resource::GetCPUMemorySize() const noexcept { return 0; }
 }
\ No newline at end of file
@@ -1,15 +1,91 @@
+#include <algorithm>
+#include <cstdio>
+
 #include "FaceEngine/ResourceManager.h"
+#include "FaceEngine/Exception.h"
+#include "FaceEngine/ResourcePool.h"
 
 namespace FaceEngine
 {
+    static constexpr std::uint32_t IndexMask = ResourceManager::MaxResources - 1;
+    static constexpr std::uint32_t MaxGeneration = (1U << (32 - ResourceManager::IndexBits)) - 1;
+
+    bool ResourceManager::IsTracked(const Resource* r) const noexcept
+    {
+        return GetResource(r->resourceHandle) == r;
+    }
+
+    void ResourceManager::Remove(Resource* r) noexcept
+    {
+        std::uint32_t index = r->resourceHandle & IndexMask;
+        Slot& slot = slots[index];
+
+        // keep resources contiguous by moving the last resource into the hole
+        Resource* last = resources.back();
+        resources[slot.Index] = last;
+        infos[slot.Index] = std::move(infos.back());
+        slots[last->resourceHandle & IndexMask].Index = slot.Index;
+        resources.pop_back();
+        infos.pop_back();
+
+        // generation zero is never used so a null handle is never valid
+        slot.Generation = slot.Generation == MaxGeneration ? 1 : slot.Generation + 1;
+        slot.Index = freeSlot;
+        freeSlot = index;
+        r->resourceHandle = NullResourceHandle;
+    }
+
     bool ResourceManager::TrackResource(Resource* r)
     {
-        return resources.insert(r).second;
+        if (r == nullptr)
+        {
+            return false;
+        }
+        else if (r->resourceHandle != NullResourceHandle)
+        {
+        #ifndef NDEBUG
+            if (!IsTracked(r))
+            {
+                throw Exception::FromMessage("FaceEngine::ResourceManager::TrackResource", "Resource is tracked by another ResourceManager.");
+            }
+        #endif
+
+            return false;
+        }
+
+        std::uint32_t index;
+
+        if (freeSlot != MaxResources)
+        {
+            index = freeSlot;
+            freeSlot = slots[index].Index;
+        }
+        else if (slots.size() < MaxResources)
+        {
+            index = slots.size();
+            slots.push_back(Slot { 1, 0 });
+        }
+        else
+        {
+            throw Exception::FromMessage("FaceEngine::ResourceManager::TrackResource", "Too many resources.");
+        }
+
+        slots[index].Index = resources.size();
+        resources.push_back(r);
+        infos.push_back(ResourceInfo { creationTag, nextSerial++, gpuMemory.GetFrame(), std::chrono::steady_clock::now() });
+        r->resourceHandle = (slots[index].Generation << IndexBits) | index;
+        return true;
     }
 
     bool ResourceManager::UntrackResource(Resource* r)
     {
-        return resources.erase(r);
+        if (r == nullptr || !IsTracked(r))
+        {
+            return false;
+        }
+
+        Remove(r);
+        return true;
     }
 
     bool ResourceManager::DisposeResource(Resource* r)
@@ -18,8 +94,9 @@ namespace FaceEngine
         {
             return true;
         }
-        else if (resources.erase(r))
+        else if (r != nullptr && IsTracked(r))
         {
+            Remove(r);
             r->Dispose();
             delete r;
             return true;
@@ -30,19 +107,305 @@ namespace FaceEngine
         }
     }
 
+    bool ResourceManager::DisposeResource(ResourceHandle handle)
+    {
+        Resource* r = GetResource(handle);
+
+        if (r == nullptr)
+        {
+        #ifndef NDEBUG
+            if (handle != NullResourceHandle && !disposingAll)
+            {
+                throw Exception::FromMessage("FaceEngine::ResourceManager::DisposeResource", "Stale resource handle.");
+            }
+        #endif
+
+            return disposingAll;
+        }
+
+        return DisposeResource(r);
+    }
+
+    std::size_t ResourceManager::DisposeResources(const std::vector<Resource*>& toDispose)
+    {
+        if (disposingAll)
+        {
+            return 0;
+        }
+
+        // resources may be disposed by another resource in the list, such as the regions of an atlas, so they're looked up by handle
+        // rather than dereferenced once disposing has started
+        std::vector<ResourceHandle> handles;
+        handles.reserve(toDispose.size());
+
+        for (Resource* r : toDispose)
+        {
+            handles.push_back(r != nullptr && IsTracked(r) ? r->resourceHandle : NullResourceHandle);
+        }
+
+        std::size_t count = 0;
+        batchingDeletes = true;
+
+        for (ResourceHandle handle : handles)
+        {
+            Resource* r = GetResource(handle);
+
+            if (r != nullptr)
+            {
+                Remove(r);
+                r->Dispose();
+                delete r;
+                ++count;
+            }
+        }
+
+        batchingDeletes = false;
+        FlushDeletes();
+        ResourcePoolBase::TrimAll();
+        return count;
+    }
+
+    Resource* ResourceManager::GetResource(ResourceHandle handle) const noexcept
+    {
+        std::uint32_t index = handle & IndexMask;
+
+        if (handle == NullResourceHandle || index >= slots.size() || slots[index].Generation != handle >> IndexBits)
+        {
+            return nullptr;
+        }
+
+        // the index of a free slot is a free list link, which may be MaxResources or point at an unrelated resource
+        std::uint32_t position = slots[index].Index;
+
+        if (position >= resources.size() || resources[position]->resourceHandle != handle)
+        {
+            return nullptr;
+        }
+
+        return resources[position];
+    }
+
+    bool ResourceManager::DeferDisposeResource(Resource* r)
+    {
+        if (r == nullptr || !IsTracked(r))
+        {
+            return false;
+        }
+
+        Remove(r);
+        deferred.push_back(r);
+        return true;
+    }
+
+    void ResourceManager::ReleaseFrame(DeferredFrame& frame) noexcept
+    {
+        batchingDeletes = true;
+
+        for (Resource* r : frame.Resources)
+        {
+            r->Dispose();
+            delete r;
+        }
+
+        batchingDeletes = false;
+        FlushDeletes();
+
+        if (frame.Fence)
+        {
+            glDeleteSync(frame.Fence);
+        }
+    }
+
+    void ResourceManager::EndFrame()
+    {
+        std::uint64_t frame = gpuMemory.GetFrame();
+
+        if (!deferred.empty())
+        {
+            // the fence is signalled once the GPU has finished every command issued this frame
+            deferredFrames.push_back(DeferredFrame { std::move(deferred), glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0), frame });
+            deferred.clear();
+        }
+
+        while (!deferredFrames.empty() && frame - deferredFrames.front().Frame >= disposeLatency)
+        {
+            DeferredFrame& front = deferredFrames.front();
+
+            if (front.Fence)
+            {
+                GLenum status = glClientWaitSync(front.Fence, 0, 0);
+
+                if (status != GL_ALREADY_SIGNALED && status != GL_CONDITION_SATISFIED)
+                {
+                    break;
+                }
+            }
+
+            ReleaseFrame(front);
+            deferredFrames.pop_front();
+        }
+
+        gpuMemory.NextFrame();
+
+        if (reportInterval > 0 && gpuMemory.GetFrame() % reportInterval == 0)
+        {
+            DumpReport();
+        }
+    }
+
+    void ResourceManager::DeleteTexture(GLuint texture)
+    {
+        textureDeletes.push_back(texture);
+
+        if (!batchingDeletes)
+        {
+            FlushDeletes();
+        }
+    }
+
+    void ResourceManager::DeleteBuffer(GLuint buffer)
+    {
+        bufferDeletes.push_back(buffer);
+
+        if (!batchingDeletes)
+        {
+            FlushDeletes();
+        }
+    }
+
+    void ResourceManager::FlushDeletes() noexcept
+    {
+        if (!textureDeletes.empty())
+        {
+            glDeleteTextures(textureDeletes.size(), textureDeletes.data());
+            textureDeletes.clear();
+        }
+
+        if (!bufferDeletes.empty())
+        {
+            glDeleteBuffers(bufferDeletes.size(), bufferDeletes.data());
+            bufferDeletes.clear();
+        }
+    }
+
+    bool ResourceManager::SetResourceTag(Resource* r, const std::string& tag)
+    {
+        if (r == nullptr || !IsTracked(r))
+        {
+            return false;
+        }
+
+        infos[slots[r->resourceHandle & IndexMask].Index].Tag = tag;
+        return true;
+    }
+
+    ResourceReport ResourceManager::CreateReport(std::uint64_t minSerial) const
+    {
+        ResourceReport report;
+        report.Frame = gpuMemory.GetFrame();
+        std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+
+        for (std::size_t i = 0; i < resources.size(); ++i)
+        {
+            const ResourceInfo& info = infos[i];
+
+            if (info.Serial < minSerial)
+            {
+                continue;
+            }
+
+            ResourceReportEntry entry;
+            entry.Handle = resources[i]->resourceHandle;
+            entry.Type = ResourceReport::GetTypeName(resources[i]);
+            entry.Tag = info.Tag;
+            entry.CPUBytes = resources[i]->GetCPUMemorySize();
+            entry.GPUBytes = resources[i]->GetGPUMemorySize();
+            entry.AgeFrames = report.Frame - info.Frame;
+            entry.AgeSeconds = std::chrono::duration<double>(now - info.Created).count();
+            report.Resources.push_back(std::move(entry));
+        }
+
+        // oldest first, which is also creation order
+        std::sort(report.Resources.begin(), report.Resources.end(), [](const ResourceReportEntry& a, const ResourceReportEntry& b)
+        {
+            return a.AgeSeconds > b.AgeSeconds;
+        });
+
+        report.Summarise();
+        return report;
+    }
+
+    ResourceReport ResourceManager::GetReport() const
+    {
+        return CreateReport(0);
+    }
+
+    ResourceReport ResourceManager::GetLeakReport() const
+    {
+        return CreateReport(leakBaseline);
+    }
+
+    void ResourceManager::SetReportDump(const std::string& path, std::uint32_t interval, ResourceReportFormat format)
+    {
+        reportPath = path;
+        reportInterval = path.empty() ? 0 : interval;
+        reportFormat = format;
+    }
+
+    void ResourceManager::DumpReport() const
+    {
+        std::FILE* fp = std::fopen(reportPath.c_str(), "wb");
+
+        // dumps are diagnostics, so failing to write one shouldn't stop the game
+        if (fp)
+        {
+            std::string report = GetReport().ToString(reportFormat);
+            std::fwrite(report.data(), 1, report.size(), fp);
+            std::fclose(fp);
+        }
+    }
+
     void ResourceManager::DisposeAllResources()
     {
+        if (leakReporting)
+        {
+            ResourceReport leaks = GetLeakReport();
+
+            if (!leaks.Resources.empty())
+            {
+                std::fprintf(stderr, "FaceEngine: %zu resources were not disposed before exit.\n%s", leaks.Resources.size(), leaks.ToText().c_str());
+            }
+        }
+
         disposingAll = true;
 
+        // deferred resources are no longer referenced by anything once the game has stopped drawing
+        if (!deferred.empty())
+        {
+            deferredFrames.push_back(DeferredFrame { std::move(deferred), nullptr, gpuMemory.GetFrame() });
+            deferred.clear();
+        }
+
+        for (DeferredFrame& frame : deferredFrames)
+        {
+            ReleaseFrame(frame);
+        }
+
+        deferredFrames.clear();
+        batchingDeletes = true;
+
+        // dispose from the back so no resources have to be moved
         while (!resources.empty())
         {
-            Resource* r = (*resources.begin());
+            Resource* r = resources.back();
+            Remove(r);
             r->Dispose();
             delete r;
-            resources.erase(r);
         }
 
-        resources.clear();
+        batchingDeletes = false;
+        FlushDeletes();
+        ResourcePoolBase::TrimAll();
         disposingAll = false;
     }
 }
\ No newline at end of file
@@ -0,0 +1,49 @@
+#include "FaceEngine/ResourcePool.h"
+
+namespace FaceEngine
+{
+    ResourcePoolBase*& ResourcePoolBase::GetPools() noexcept
+    {
+        static ResourcePoolBase* pools = nullptr;
+        return pools;
+    }
+
+    std::mutex& ResourcePoolBase::GetPoolsMutex() noexcept
+    {
+        static std::mutex poolsMutex;
+        return poolsMutex;
+    }
+
+    ResourcePoolBase::ResourcePoolBase() noexcept
+    {
+        std::lock_guard<std::mutex> lock(GetPoolsMutex());
+        nextPool = GetPools();
+        GetPools() = this;
+    }
+
+    ResourcePoolBase::~ResourcePoolBase()
+    {
+        std::lock_guard<std::mutex> lock(GetPoolsMutex());
+        ResourcePoolBase** link = &GetPools();
+
+        while (*link != this)
+        {
+            link = &(*link)->nextPool;
+        }
+
+        *link = nextPool;
+    }
+
+    std::size_t ResourcePoolBase::TrimAll() noexcept
+    {
+        std::lock_guard<std::mutex> lock(GetPoolsMutex());
+        std::size_t freed = 0;
+
+        for (ResourcePoolBase* pool = GetPools(); pool != nullptr; pool = pool->nextPool)
+        {
+            freed += pool->Trim();
+        }
+
+        return freed;
+    }
+}
\ No newline at end of file
@@ -0,0 +1,159 @@
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <map>
+#include <typeinfo>
+
+#ifdef __GNUG__
+#include <cxxabi.h>
+#endif
+
+#include "FaceEngine/ResourceReport.h"
+#include "FaceEngine/JSON.h"
+
+namespace FaceEngine
+{
+    std::size_t ResourceReport::GetTotalCPUBytes() const noexcept
+    {
+        std::size_t total = 0;
+
+        for (const ResourceReportEntry& entry : Resources)
+        {
+            total += entry.CPUBytes;
+        }
+
+        return total;
+    }
+
+    std::size_t ResourceReport::GetTotalGPUBytes() const noexcept
+    {
+        std::size_t total = 0;
+
+        for (const ResourceReportEntry& entry : Resources)
+        {
+            total += entry.GPUBytes;
+        }
+
+        return total;
+    }
+
+    void ResourceReport::Summarise()
+    {
+        std::map<std::string, ResourceTypeSummary> summaries;
+
+        for (const ResourceReportEntry& entry : Resources)
+        {
+            ResourceTypeSummary& summary = summaries[entry.Type];
+            summary.Type = entry.Type;
+            ++summary.Count;
+            summary.CPUBytes += entry.CPUBytes;
+            summary.GPUBytes += entry.GPUBytes;
+            summary.OldestSeconds = std::max(summary.OldestSeconds, entry.AgeSeconds);
+        }
+
+        Types.clear();
+
+        for (auto& summary : summaries)
+        {
+            Types.push_back(std::move(summary.second));
+        }
+
+        std::stable_sort(Types.begin(), Types.end(), [](const ResourceTypeSummary& a, const ResourceTypeSummary& b)
+        {
+            return a.CPUBytes + a.GPUBytes > b.CPUBytes + b.GPUBytes;
+        });
+    }
+
+    std::string ResourceReport::ToText() const
+    {
+        std::string result;
+        char line[512];
+
+        std::snprintf(line, sizeof(line), "Resources at frame %llu: %zu live, %zu CPU bytes, %zu GPU bytes\n",
+            (unsigned long long)Frame, Resources.size(), GetTotalCPUBytes(), GetTotalGPUBytes());
+        result += line;
+        std::snprintf(line, sizeof(line), "%-40s %8s %14s %14s %12s\n", "Type", "Count", "CPU bytes", "GPU bytes", "Oldest (s)");
+        result += line;
+
+        for (const ResourceTypeSummary& summary : Types)
+        {
+            std::snprintf(line, sizeof(line), "%-40s %8zu %14zu %14zu %12.2f\n",
+                summary.Type.c_str(), summary.Count, summary.CPUBytes, summary.GPUBytes, summary.OldestSeconds);
+            result += line;
+        }
+
+        for (const ResourceReportEntry& entry : Resources)
+        {
+            std::snprintf(line, sizeof(line), "  [%08x] %s CPU %zu GPU %zu age %llu frames (%.2f s)",
+                entry.Handle, entry.Type.c_str(), entry.CPUBytes, entry.GPUBytes, (unsigned long long)entry.AgeFrames, entry.AgeSeconds);
+            result += line;
+
+            if (!entry.Tag.empty())
+            {
+                result += " tag ";
+                result += entry.Tag;
+            }
+
+            result += '\n';
+        }
+
+        return result;
+    }
+
+    std::string ResourceReport::ToJSON() const
+    {
+        std::string result;
+        char number[128];
+
+        std::snprintf(number, sizeof(number), "{\"frame\":%llu,\"cpuBytes\":%zu,\"gpuBytes\":%zu,\"types\":[",
+            (unsigned long long)Frame, GetTotalCPUBytes(), GetTotalGPUBytes());
+        result += number;
+
+        for (std::size_t i = 0; i < Types.size(); ++i)
+        {
+            const ResourceTypeSummary& summary = Types[i];
+            result += i > 0 ? ",{\"type\":\"" : "{\"type\":\"";
+            result += EscapeJSON(summary.Type);
+            std::snprintf(number, sizeof(number), "\",\"count\":%zu,\"cpuBytes\":%zu,\"gpuBytes\":%zu,\"oldestSeconds\":%.3f}",
+                summary.Count, summary.CPUBytes, summary.GPUBytes, summary.OldestSeconds);
+            result += number;
+        }
+
+        result += "],\"resources\":[";
+
+        for (std::size_t i = 0; i < Resources.size(); ++i)
+        {
+            const ResourceReportEntry& entry = Resources[i];
+            std::snprintf(number, sizeof(number), "%s{\"handle\":%u,\"type\":\"", i > 0 ? "," : "", entry.Handle);
+            result += number;
+            result += EscapeJSON(entry.Type);
+            result += "\",\"tag\":\"";
+            result += EscapeJSON(entry.Tag);
+            std::snprintf(number, sizeof(number), "\",\"cpuBytes\":%zu,\"gpuBytes\":%zu,\"ageFrames\":%llu,\"ageSeconds\":%.3f}",
+                entry.CPUBytes, entry.GPUBytes, (unsigned long long)entry.AgeFrames, entry.AgeSeconds);
+            result += number;
+        }
+
+        result += "]}";
+        return result;
+    }
+
+    std::string ResourceReport::GetTypeName(const Resource* r)
+    {
+        const char* name = typeid(*r).name();
+
+    #ifdef __GNUG__
+        int status = 0;
+        char* demangled = abi::__cxa_demangle(name, nullptr, nullptr, &status);
+
+        if (status == 0 && demangled != nullptr)
+        {
+            std::string result(demangled);
+            std::free(demangled);
+            return result;
+        }
+    #endif
+
+        return name;
+    }
+}
\ No newline at end of file
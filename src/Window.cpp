@@ -1,10 +1,224 @@
+#include <algorithm>
+
+#ifdef FACE_ENGINE_EGL
+#include <cstring>
+#include <EGL/egl.h>
+#include <EGL/eglext.h>
+#endif
+
 #include "FaceEngine/Window.h"
 
+#define OFFSCREEN_FRAMES_IN_FLIGHT 2UL
+
 namespace FaceEngine
 {
+    struct __OffscreenContext
+    {
+    #ifdef FACE_ENGINE_EGL
+        EGLDisplay Display = EGL_NO_DISPLAY;
+        EGLContext Context = EGL_NO_CONTEXT;
+        EGLSurface Surface = EGL_NO_SURFACE;
+    #else
+        GLFWwindow* HiddenWindow = nullptr;
+    #endif
+        bool Current = false;
+        GLuint Framebuffer = 0;
+        GLuint ColourBuffer = 0;
+        GLuint DepthBuffer = 0;
+        GLsync Frames[OFFSCREEN_FRAMES_IN_FLIGHT] = { };
+        std::size_t Frame = 0;
+    };
+
+    namespace
+    {
+    #ifdef FACE_ENGINE_EGL
+        bool HasExtension(const char* extensions, const char* name) noexcept
+        {
+            std::size_t length = std::strlen(name);
+
+            while (extensions != nullptr && *extensions != '\0')
+            {
+                const char* end = std::strchr(extensions, ' ');
+                std::size_t tokenLength = end == nullptr ? std::strlen(extensions) : end - extensions;
+
+                if (tokenLength == length && std::strncmp(extensions, name, length) == 0)
+                {
+                    return true;
+                }
+
+                extensions = end == nullptr ? nullptr : end + 1;
+            }
+
+            return false;
+        }
+
+        EGLDisplay InitialiseDisplay(EGLDisplay display) noexcept
+        {
+            return display != EGL_NO_DISPLAY && eglInitialize(display, nullptr, nullptr) ? display : EGL_NO_DISPLAY;
+        }
+
+        EGLDisplay OpenDisplay() noexcept
+        {
+            // client extensions are null if EGL_EXT_client_extensions isn't supported
+            const char* clientExtensions = eglQueryString(EGL_NO_DISPLAY, EGL_EXTENSIONS);
+            auto getPlatformDisplay = (PFNEGLGETPLATFORMDISPLAYEXTPROC)eglGetProcAddress("eglGetPlatformDisplayEXT");
+            EGLDisplay display = EGL_NO_DISPLAY;
+
+            if (getPlatformDisplay == nullptr)
+            {
+                return InitialiseDisplay(eglGetDisplay(EGL_DEFAULT_DISPLAY));
+            }
+
+            // Mesa, including llvmpipe, can render without any display server
+            if (HasExtension(clientExtensions, "EGL_MESA_platform_surfaceless"))
+            {
+                display = InitialiseDisplay(getPlatformDisplay(EGL_PLATFORM_SURFACELESS_MESA, EGL_DEFAULT_DISPLAY, nullptr));
+            }
+
+            // drivers without the surfaceless platform, such as NVIDIA's, expose their devices instead
+            if (display == EGL_NO_DISPLAY && HasExtension(clientExtensions, "EGL_EXT_platform_device"))
+            {
+                auto queryDevices = (PFNEGLQUERYDEVICESEXTPROC)eglGetProcAddress("eglQueryDevicesEXT");
+                EGLDeviceEXT device;
+                EGLint deviceCount = 0;
+
+                if (queryDevices != nullptr && queryDevices(1, &device, &deviceCount) && deviceCount > 0)
+                {
+                    display = InitialiseDisplay(getPlatformDisplay(EGL_PLATFORM_DEVICE_EXT, device, nullptr));
+                }
+            }
+
+            return display != EGL_NO_DISPLAY ? display : InitialiseDisplay(eglGetDisplay(EGL_DEFAULT_DISPLAY));
+        }
+
+        void CreateContext(__OffscreenContext& offscreen)
+        {
+            offscreen.Display = OpenDisplay();
+
+            if (offscreen.Display == EGL_NO_DISPLAY)
+            {
+                throw Exception::FromMessage("FaceEngine::Window::Window", "Couldn't open an EGL display.");
+            }
+            else if (!eglBindAPI(EGL_OPENGL_API))
+            {
+                throw Exception::FromMessage("FaceEngine::Window::Window", "EGL doesn't support OpenGL.");
+            }
+
+            const char* extensions = eglQueryString(offscreen.Display, EGL_EXTENSIONS);
+            bool surfaceless = HasExtension(extensions, "EGL_KHR_surfaceless_context");
+            EGLint configAttributes[] =
+            {
+                EGL_SURFACE_TYPE, surfaceless ? 0 : EGL_PBUFFER_BIT,
+                EGL_RENDERABLE_TYPE, EGL_OPENGL_BIT,
+                EGL_NONE
+            };
+            EGLConfig config = nullptr;
+            EGLint configCount = 0;
+
+            // the framebuffer object is the only thing drawn to, so a context without a config is as good as any
+            if (!eglChooseConfig(offscreen.Display, configAttributes, &config, 1, &configCount) || configCount == 0)
+            {
+                if (!surfaceless || !HasExtension(extensions, "EGL_KHR_no_config_context"))
+                {
+                    throw Exception::FromMessage("FaceEngine::Window::Window", "Couldn't find an EGL config for OpenGL.");
+                }
+
+                config = EGL_NO_CONFIG_KHR;
+            }
+
+            EGLint contextAttributes[] =
+            {
+                EGL_CONTEXT_MAJOR_VERSION_KHR, 3,
+                EGL_CONTEXT_MINOR_VERSION_KHR, 3,
+                EGL_CONTEXT_OPENGL_PROFILE_MASK_KHR, EGL_CONTEXT_OPENGL_CORE_PROFILE_BIT_KHR,
+                EGL_NONE
+            };
+            offscreen.Context = eglCreateContext(offscreen.Display, config, EGL_NO_CONTEXT, contextAttributes);
+
+            if (offscreen.Context == EGL_NO_CONTEXT)
+            {
+                throw Exception::FromMessage("FaceEngine::Window::Window", "Couldn't create an OpenGL 3.3 context.");
+            }
+
+            if (!surfaceless)
+            {
+                EGLint surfaceAttributes[] = { EGL_WIDTH, 1, EGL_HEIGHT, 1, EGL_NONE };
+                offscreen.Surface = eglCreatePbufferSurface(offscreen.Display, config, surfaceAttributes);
+
+                if (offscreen.Surface == EGL_NO_SURFACE)
+                {
+                    throw Exception::FromMessage("FaceEngine::Window::Window", "Couldn't create an EGL pbuffer.");
+                }
+            }
+
+            if (!eglMakeCurrent(offscreen.Display, offscreen.Surface, offscreen.Surface, offscreen.Context))
+            {
+                throw Exception::FromMessage("FaceEngine::Window::Window", "Couldn't make the EGL context current.");
+            }
+
+            offscreen.Current = true;
+
+            if (!gladLoadGLLoader((GLADloadproc)eglGetProcAddress))
+            {
+                throw Exception::FromMessage("FaceEngine::Window::Window", "Could not load OpenGL functions.");
+            }
+        }
+    #endif
+
+        // releases whatever was created, even if creating the context failed part way through
+        void ReleaseContext(__OffscreenContext& offscreen) noexcept
+        {
+            if (offscreen.Current)
+            {
+                for (GLsync& frame : offscreen.Frames)
+                {
+                    if (frame != nullptr)
+                    {
+                        glDeleteSync(frame);
+                        frame = nullptr;
+                    }
+                }
+
+                glDeleteFramebuffers(1, &offscreen.Framebuffer);
+                glDeleteRenderbuffers(1, &offscreen.ColourBuffer);
+                glDeleteRenderbuffers(1, &offscreen.DepthBuffer);
+            }
+
+        #ifdef FACE_ENGINE_EGL
+            if (offscreen.Display != EGL_NO_DISPLAY)
+            {
+                eglMakeCurrent(offscreen.Display, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT);
+
+                if (offscreen.Surface != EGL_NO_SURFACE)
+                {
+                    eglDestroySurface(offscreen.Display, offscreen.Surface);
+                }
+
+                if (offscreen.Context != EGL_NO_CONTEXT)
+                {
+                    eglDestroyContext(offscreen.Display, offscreen.Context);
+                }
+
+                eglTerminate(offscreen.Display);
+                eglReleaseThread();
+            }
+        #else
+            if (offscreen.HiddenWindow != nullptr)
+            {
+                glfwDestroyWindow(offscreen.HiddenWindow);
+            }
+
+            glfwTerminate();
+        #endif
+
+            offscreen.Current = false;
+        }
+    }
+
     Window::Window(GraphicsDevice* d)
     {
         graphicsDevice = d;
+        offscreen = nullptr;
         title = "Game";
         resolution = graphicsDevice->GetPrimaryDisplay().GetMinResolution();
         winHandle = glfwCreateWindow(resolution.GetWidth(), resolution.GetHeight(), title.c_str(), NULL, NULL);
@@ -20,8 +234,151 @@ namespace FaceEngine
         clearColour = Colour::Black;
     }
 
+    Window::Window(GraphicsDevice* d, const Resolution& r)
+    {
+        graphicsDevice = d;
+        winHandle = nullptr;
+        title = "Game";
+        resolution = r;
+        fullscreen = false;
+        vsync = false;
+        clearColour = Colour::Black;
+        offscreen = new __OffscreenContext;
+
+        try
+        {
+        #ifdef FACE_ENGINE_EGL
+            CreateContext(*offscreen);
+        #else
+            // without EGL the context belongs to a hidden window, which still needs a display
+            if (!glfwInit())
+            {
+                throw Exception::FromMessage("FaceEngine::Window::Window", "Couldn't initialise GLFW.");
+            }
+
+            SetContextHints();
+            offscreen->HiddenWindow = glfwCreateWindow(1, 1, title.c_str(), NULL, NULL);
+
+            if (offscreen->HiddenWindow == NULL)
+            {
+                throw Exception::FromMessage("FaceEngine::Window::Window", "Couldn't create window.");
+            }
+
+            glfwMakeContextCurrent(offscreen->HiddenWindow);
+            offscreen->Current = true;
+
+            if (!gladLoadGLLoader((GLADloadproc)glfwGetProcAddress))
+            {
+                throw Exception::FromMessage("FaceEngine::Window::Window", "Could not load OpenGL functions.");
+            }
+        #endif
+
+            CreateFramebuffer();
+        }
+        catch (const Exception& e)
+        {
+            ReleaseContext(*offscreen);
+            delete offscreen;
+            offscreen = nullptr;
+            throw e;
+        }
+    }
+
+    void Window::SetContextHints() noexcept
+    {
+        glfwDefaultWindowHints();
+        glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 3);
+        glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 3);
+        glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
+        glfwWindowHint(GLFW_VISIBLE, GLFW_FALSE);
+        glfwWindowHint(GLFW_RESIZABLE, GLFW_FALSE);
+        glfwWindowHint(GLFW_FOCUS_ON_SHOW, GLFW_TRUE);
+    #ifdef __APPLE__
+        #warning imagine being an apple user
+        glfwWindowHint(GLFW_OPENGL_FORWARD_COMPAT, GL_TRUE);
+    #endif
+    }
+
+    void Window::CreateFramebuffer()
+    {
+        if (offscreen->Framebuffer == 0)
+        {
+            glGenFramebuffers(1, &offscreen->Framebuffer);
+            glGenRenderbuffers(1, &offscreen->ColourBuffer);
+            glGenRenderbuffers(1, &offscreen->DepthBuffer);
+        }
+
+        glBindRenderbuffer(GL_RENDERBUFFER, offscreen->ColourBuffer);
+        glRenderbufferStorage(GL_RENDERBUFFER, GL_RGBA8, resolution.GetWidth(), resolution.GetHeight());
+        glBindRenderbuffer(GL_RENDERBUFFER, offscreen->DepthBuffer);
+        glRenderbufferStorage(GL_RENDERBUFFER, GL_DEPTH24_STENCIL8, resolution.GetWidth(), resolution.GetHeight());
+        glBindRenderbuffer(GL_RENDERBUFFER, 0);
+
+        // the framebuffer stays bound for the lifetime of the window, standing in for the default framebuffer
+        glBindFramebuffer(GL_FRAMEBUFFER, offscreen->Framebuffer);
+        glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_RENDERBUFFER, offscreen->ColourBuffer);
+        glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_DEPTH_STENCIL_ATTACHMENT, GL_RENDERBUFFER, offscreen->DepthBuffer);
+
+        if (glCheckFramebufferStatus(GL_FRAMEBUFFER) != GL_FRAMEBUFFER_COMPLETE)
+        {
+            throw Exception::FromMessage("FaceEngine::Window::CreateFramebuffer", "Couldn't create the offscreen framebuffer.");
+        }
+
+        glViewport(0, 0, resolution.GetWidth(), resolution.GetHeight());
+    }
+
+    void Window::SwapBuffers() noexcept
+    {
+        if (offscreen == nullptr)
+        {
+            glfwSwapBuffers(winHandle);
+            return;
+        }
+
+        // like a swap chain, stop the CPU running more than a couple of frames ahead of the GPU
+        GLsync& oldest = offscreen->Frames[offscreen->Frame];
+
+        if (oldest != nullptr)
+        {
+            glClientWaitSync(oldest, GL_SYNC_FLUSH_COMMANDS_BIT, GL_TIMEOUT_IGNORED);
+            glDeleteSync(oldest);
+        }
+
+        oldest = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+        offscreen->Frame = (offscreen->Frame + 1) % OFFSCREEN_FRAMES_IN_FLIGHT;
+        glFlush();
+    }
+
+    GLuint Window::GetFramebuffer() const noexcept
+    {
+        return offscreen != nullptr ? offscreen->Framebuffer : 0;
+    }
+
+    bool Window::ShouldClose() noexcept
+    {
+        return offscreen != nullptr ? closeRequested.load() : glfwWindowShouldClose(winHandle);
+    }
+
+    void Window::RequestClose() noexcept
+    {
+        closeRequested.store(true);
+
+        if (winHandle != nullptr)
+        {
+            glfwSetWindowShouldClose(winHandle, GLFW_TRUE);
+        }
+    }
+
     void Window::Dispose() noexcept
     {
+        if (offscreen != nullptr)
+        {
+            ReleaseContext(*offscreen);
+            delete offscreen;
+            offscreen = nullptr;
+            return;
+        }
+
         glfwDestroyWindow(winHandle);
         winHandle = nullptr;
     }
@@ -29,11 +386,30 @@ namespace FaceEngine
     void Window::SetTitle(const std::string& t) noexcept
     {
         title = t;
-        glfwSetWindowTitle(winHandle, title.c_str());
+
+        if (winHandle != nullptr)
+        {
+            glfwSetWindowTitle(winHandle, title.c_str());
+        }
     }
 
     void Window::SetResolution(const Resolution& r)
     {
+        if (offscreen != nullptr)
+        {
+            GLint maxSize = 0;
+            glGetIntegerv(GL_MAX_RENDERBUFFER_SIZE, &maxSize);
+
+            if (r.GetWidth() == 0 || r.GetHeight() == 0 || r.GetWidth() > maxSize || r.GetHeight() > maxSize)
+            {
+                throw Exception::FromMessage("FaceEngine::Window::SetResolution", "Invalid resolution.");
+            }
+
+            resolution = r;
+            CreateFramebuffer();
+            return;
+        }
+
         const Resolution& min = graphicsDevice->GetPrimaryDisplay().GetMinResolution();
         const Resolution& max = graphicsDevice->GetPrimaryDisplay().GetMaxResolution();
 
@@ -54,6 +430,12 @@ namespace FaceEngine
 
     void Window::SetFullscreen(bool f) noexcept
     {
+        // an offscreen window has no monitor to fill
+        if (offscreen != nullptr)
+        {
+            return;
+        }
+
         fullscreen = f;
         const Display& display = graphicsDevice->GetPrimaryDisplay();
         const Resolution& res = display.GetMaxResolution();
@@ -76,12 +458,16 @@ namespace FaceEngine
     void Window::SetVSync(bool v) noexcept
     {
         vsync = v;
-        glfwSwapInterval(vsync ? 1 : 0);
+
+        if (winHandle != nullptr)
+        {
+            glfwSwapInterval(vsync ? 1 : 0);
+        }
     }
 
     void Window::CenterWindow() const noexcept
     {
-        if (!fullscreen)
+        if (!fullscreen && winHandle != nullptr)
         {
             const Resolution& res = graphicsDevice->GetPrimaryDisplay().GetMaxResolution();
             glfwSetWindowPos(winHandle, (res.GetWidth() - resolution.GetWidth()) / 2, (res.GetHeight() - resolution.GetHeight()) / 2);
@@ -103,4 +489,26 @@ namespace FaceEngine
 
         glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
     }
+
+    std::vector<std::uint8_t> Window::ReadPixels() const
+    {
+        const Resolution& res = GetResolution();
+        std::size_t rowSize = (std::size_t)res.GetWidth() * 4;
+        std::vector<std::uint8_t> pixels(rowSize * res.GetHeight());
+        GLint alignment;
+
+        glGetIntegerv(GL_PACK_ALIGNMENT, &alignment);
+        glPixelStorei(GL_PACK_ALIGNMENT, 1);
+        glReadBuffer(offscreen != nullptr ? GL_COLOR_ATTACHMENT0 : GL_BACK);
+        glReadPixels(0, 0, res.GetWidth(), res.GetHeight(), GL_RGBA, GL_UNSIGNED_BYTE, pixels.data());
+        glPixelStorei(GL_PACK_ALIGNMENT, alignment);
+
+        // OpenGL's rows start at the bottom
+        for (std::size_t top = 0, bottom = res.GetHeight(); top + 1 < bottom; ++top, --bottom)
+        {
+            std::swap_ranges(pixels.begin() + top * rowSize, pixels.begin() + (top + 1) * rowSize, pixels.begin() + (bottom - 1) * rowSize);
+        }
+
+        return pixels;
+    }
 }
\ No newline at end of file
@@ -1,10 +1,225 @@
+#include <cmath>
+#include <cstdint>
 #include <iostream>
+#include <string>
 
+#include "FaceEngine/Math/Matrix4f.h"
+#include "FaceEngine/Math/Rectangle.h"
+#include "FaceEngine/Math/SIMD.h"
 #include "FaceEngine/Math/Vector2.h"
 
+using FaceEngine::Matrix4f;
+using FaceEngine::Vector3f;
+using FaceEngine::Vector4f;
+
+// The math types are constexpr, so these are checked by the compiler.
+static_assert(FaceEngine::Vector2f(1, 2) + FaceEngine::Vector2f::One == FaceEngine::Vector2f(2, 3));
+static_assert(FaceEngine::Matrix4f::CreateTranslation(1, 2, 3).GetTranslation() == FaceEngine::Vector3f(1, 2, 3));
+static_assert(FaceEngine::Rectanglef(0, 0, 2, 2) + FaceEngine::Rectanglef(1, 1, 4, 4) == FaceEngine::Rectanglef(0, 0, 5, 5));
+
+namespace
+{
+    // Matrix4f has SSE, AVX, NEON and scalar implementations, so its results are checked against double precision references at runtime
+    constexpr int MatrixCount = 64;
+    constexpr double Tolerance = 1e-4;
+
+    int failures = 0;
+
+    class InputGenerator
+    {
+    private:
+        std::uint32_t state = 12345;
+    public:
+        // uniform in [min, max)
+        inline float Next(float min, float max) noexcept
+        {
+            state = state * 1664525 + 1013904223;
+            return min + (max - min) * ((state >> 8) / 16777216.0f);
+        }
+    };
+
+    void Check(bool passed, const std::string& test, int i)
+    {
+        if (!passed)
+        {
+            std::cerr << "FAILED: " << test << " (input " << i << ")\n";
+            ++failures;
+        }
+    }
+
+    bool Near(double actual, double expected) noexcept
+    {
+        return std::abs(actual - expected) <= Tolerance * (1 + std::abs(expected));
+    }
+
+    bool Near(const Matrix4f& actual, const double (&expected)[16]) noexcept
+    {
+        for (int j = 0; j < 16; ++j)
+        {
+            if (!Near(actual[j], expected[j]))
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    void Multiply(const Matrix4f& a, const Matrix4f& b, double (&product)[16]) noexcept
+    {
+        for (int row = 0; row < 4; ++row)
+        {
+            for (int column = 0; column < 4; ++column)
+            {
+                product[row * 4 + column] = 0;
+
+                for (int k = 0; k < 4; ++k)
+                {
+                    product[row * 4 + column] += (double)a[row * 4 + k] * b[k * 4 + column];
+                }
+            }
+        }
+    }
+
+    double Determinant3(const Matrix4f& m, int skipRow, int skipColumn) noexcept
+    {
+        double minor[9];
+        int n = 0;
+
+        for (int row = 0; row < 4; ++row)
+        {
+            if (row == skipRow)
+            {
+                continue;
+            }
+
+            for (int column = 0; column < 4; ++column)
+            {
+                if (column != skipColumn)
+                {
+                    minor[n++] = m[row * 4 + column];
+                }
+            }
+        }
+
+        return minor[0] * (minor[4] * minor[8] - minor[5] * minor[7]) - minor[1] * (minor[3] * minor[8] - minor[5] * minor[6])
+             + minor[2] * (minor[3] * minor[7] - minor[4] * minor[6]);
+    }
+
+    double Determinant(const Matrix4f& m) noexcept
+    {
+        double determinant = 0;
+
+        for (int column = 0; column < 4; ++column)
+        {
+            determinant += (column % 2 == 0 ? 1 : -1) * m[column] * Determinant3(m, 0, column);
+        }
+
+        return determinant;
+    }
+
+    void TestMatrix4f(const Matrix4f& a, const Matrix4f& b, const Vector4f& v4, const Vector3f& v3, int i)
+    {
+        double expected[16];
+
+        Multiply(a, b, expected);
+        Check(Near(a * b, expected), "Matrix4f::operator*(Matrix4f)", i);
+
+        Matrix4f product = a;
+        product.Multiply(b);
+        Check(Near(product, expected), "Matrix4f::Multiply(Matrix4f)", i);
+
+        // the product is written over the operand it's read from
+        Multiply(a, a, expected);
+        Matrix4f square = a;
+        square.Multiply(square);
+        Check(Near(square, expected), "Matrix4f::Multiply(self)", i);
+
+        Matrix4f transpose = a;
+        transpose.Transpose();
+        bool transposed = true;
+
+        for (int j = 0; j < 16; ++j)
+        {
+            transposed = transposed && transpose[j] == a[(j % 4) * 4 + j / 4];
+        }
+
+        Check(transposed, "Matrix4f::Transpose", i);
+        Check(Near(a.GetDeterminant(), Determinant(a)), "Matrix4f::GetDeterminant", i);
+
+        const double identity[16] = { 1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1 };
+        Multiply(a.GetInverse(), a, expected);
+        Matrix4f inverseTimesA;
+
+        for (int j = 0; j < 16; ++j)
+        {
+            inverseTimesA[j] = (float)expected[j];
+        }
+
+        Check(Near(inverseTimesA, identity), "Matrix4f::GetInverse", i);
+
+        Vector4f transformed4 = a * v4;
+        const float components4[4] = { v4.X, v4.Y, v4.Z, v4.W };
+        const float results4[4] = { transformed4.X, transformed4.Y, transformed4.Z, transformed4.W };
+        bool near4 = true;
+
+        for (int row = 0; row < 4; ++row)
+        {
+            double sum = 0;
+
+            for (int k = 0; k < 4; ++k)
+            {
+                sum += (double)a[row * 4 + k] * components4[k];
+            }
+
+            near4 = near4 && Near(results4[row], sum);
+        }
+
+        Check(near4, "Matrix4f::Transform(Vector4f)", i);
+
+        Vector3f transformed3 = v3;
+        a.Transform(transformed3);
+        const float components3[4] = { v3.X, v3.Y, v3.Z, 1 };
+        const float results3[3] = { transformed3.X, transformed3.Y, transformed3.Z };
+        bool near3 = true;
+
+        for (int row = 0; row < 3; ++row)
+        {
+            double sum = 0;
+
+            for (int k = 0; k < 4; ++k)
+            {
+                sum += (double)a[row * 4 + k] * components3[k];
+            }
+
+            near3 = near3 && Near(results3[row], sum);
+        }
+
+        Check(near3, "Matrix4f::Transform(Vector3f)", i);
+    }
+}
+
 int main()
 {
-    FaceEngine::Vector2f vec2 = FaceEngine::Vector2f(4, 5);
-    std::cout << vec2 << "\n\n";
-    return 0;
+    InputGenerator random;
+    Matrix4f matrices[MatrixCount];
+
+    for (Matrix4f& matrix : matrices)
+    {
+        // diagonally dominant, so every matrix is invertible
+        for (int j = 0; j < 16; ++j)
+        {
+            matrix[j] = j % 5 == 0 ? random.Next(8.0f, 16.0f) : random.Next(-1.0f, 1.0f);
+        }
+    }
+
+    for (int i = 0; i < MatrixCount; ++i)
+    {
+        Vector4f v4(random.Next(-100.0f, 100.0f), random.Next(-100.0f, 100.0f), random.Next(-100.0f, 100.0f), random.Next(-2.0f, 2.0f));
+        Vector3f v3(random.Next(-100.0f, 100.0f), random.Next(-100.0f, 100.0f), random.Next(-100.0f, 100.0f));
+        TestMatrix4f(matrices[i], matrices[(i + 1) % MatrixCount], v4, v3, i);
+    }
+
+    std::cout << "Matrix4f (" << FaceEngine::SIMDInstructionSet << "): " << (failures == 0 ? "passed" : std::to_string(failures) + " failures") << "\n";
+    return failures == 0 ? 0 : 1;
 }
\ No newline at end of file
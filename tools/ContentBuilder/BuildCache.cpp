@@ -0,0 +1,64 @@
+#include "BuildCache.h"
+
+#include <fstream>
+#include <stdexcept>
+
+namespace FaceEngine
+{
+    BuildCache::BuildCache(const std::string& p) : path(p)
+    {
+        std::ifstream file(path);
+        std::string output;
+        std::uint64_t hash;
+
+        // each line is a hex hash followed by the output path it was built into
+        while (file >> std::hex >> hash && std::getline(file >> std::ws, output))
+        {
+            hashes[output] = hash;
+        }
+    }
+
+    bool BuildCache::IsUpToDate(const std::string& output, std::uint64_t hash) const
+    {
+        auto it = hashes.find(output);
+        return it != hashes.end() && it->second == hash && std::ifstream(output).good();
+    }
+
+    void BuildCache::Update(const std::string& output, std::uint64_t hash)
+    {
+        hashes[output] = hash;
+    }
+
+    void BuildCache::Save() const
+    {
+        std::ofstream file(path, std::ios::trunc);
+
+        if (!file)
+        {
+            throw std::runtime_error("Couldn't write build cache \"" + path + "\".");
+        }
+
+        for (const auto& entry : hashes)
+        {
+            file << std::hex << entry.second << ' ' << entry.first << '\n';
+        }
+    }
+
+    std::uint64_t BuildCache::Hash(const void* data, std::size_t size, std::uint64_t hash) noexcept
+    {
+        const std::uint8_t* bytes = (const std::uint8_t*)data;
+
+        for (std::size_t i = 0; i < size; ++i)
+        {
+            hash ^= bytes[i];
+            hash *= 0x100000001B3ULL;
+        }
+
+        return hash;
+    }
+
+    std::uint64_t BuildCache::Hash(const std::string& text, std::uint64_t hash) noexcept
+    {
+        return Hash(text.data(), text.size(), hash);
+    }
+}
\ No newline at end of file
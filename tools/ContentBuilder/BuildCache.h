@@ -0,0 +1,43 @@
+#ifndef FACEENGINE_TOOLS_BUILDCACHE_H_
+#define FACEENGINE_TOOLS_BUILDCACHE_H_
+
+#include <cstdint>
+#include <cstddef>
+#include <string>
+#include <unordered_map>
+
+namespace FaceEngine
+{
+    /**
+     * @brief Remembers the content hash each output was last built from, so unchanged outputs can be skipped.
+     */
+    class BuildCache
+    {
+    private:
+        std::string path;
+        std::unordered_map<std::string, std::uint64_t> hashes;
+    public:
+        /**
+         * @brief Loads the cache file at the given path. A missing or unreadable cache file results in an empty cache.
+         */
+        explicit BuildCache(const std::string&);
+
+        /**
+         * @brief Returns true if the output exists and was last built from content with the given hash.
+         */
+        bool IsUpToDate(const std::string&, std::uint64_t) const;
+
+        void Update(const std::string&, std::uint64_t);
+
+        void Save() const;
+
+        /**
+         * @brief Computes a 64-bit FNV-1a hash, optionally continuing from a previous hash.
+         */
+        static std::uint64_t Hash(const void*, std::size_t, std::uint64_t = 0xCBF29CE484222325ULL) noexcept;
+
+        static std::uint64_t Hash(const std::string&, std::uint64_t = 0xCBF29CE484222325ULL) noexcept;
+    };
+}
+
+#endif
\ No newline at end of file
@@ -0,0 +1,247 @@
+#include "ContentWriter.h"
+
+#include <algorithm>
+#include <stdexcept>
+#include <zlib.h>
+
+#include "FaceEngine/ContentFormat.h"
+
+namespace FaceEngine
+{
+    void ContentWriter::WriteInt32(std::vector<std::uint8_t>& out, std::uint32_t value)
+    {
+        out.push_back((value >> 24) & 0xFF);
+        out.push_back((value >> 16) & 0xFF);
+        out.push_back((value >> 8) & 0xFF);
+        out.push_back(value & 0xFF);
+    }
+
+    static void WriteHeader(std::vector<std::uint8_t>& out, std::uint8_t version, std::uint8_t type)
+    {
+        out.insert(out.end(), ContentFileHeader.begin(), ContentFileHeader.end());
+        out.push_back(version);
+        out.push_back(type);
+    }
+
+    void ContentWriter::GenerateMipmaps(TextureContent& texture)
+    {
+        std::uint32_t w = texture.Width;
+        std::uint32_t h = texture.Height;
+        std::size_t level = 0;
+        texture.Pixels.resize((std::size_t)w * h * 4);
+        texture.MipLevels = 1;
+
+        while (w > 1 || h > 1)
+        {
+            std::uint32_t nextW = std::max(w / 2, 1U);
+            std::uint32_t nextH = std::max(h / 2, 1U);
+            std::size_t next = texture.Pixels.size();
+            texture.Pixels.resize(next + (std::size_t)nextW * nextH * 4);
+
+            for (std::uint32_t y = 0; y < nextH; ++y)
+            {
+                for (std::uint32_t x = 0; x < nextW; ++x)
+                {
+                    std::uint32_t colour[3] = { 0, 0, 0 };
+                    std::uint32_t alpha = 0;
+
+                    // odd sizes clamp to the last row or column
+                    for (std::uint32_t i = 0; i < 4; ++i)
+                    {
+                        std::uint32_t sx = std::min(x * 2 + (i & 1), w - 1);
+                        std::uint32_t sy = std::min(y * 2 + (i >> 1), h - 1);
+                        const std::uint8_t* src = texture.Pixels.data() + level + ((std::size_t)sy * w + sx) * 4;
+
+                        // weight colours by alpha so transparent texels don't darken the edges of sprites
+                        for (int c = 0; c < 3; ++c)
+                        {
+                            colour[c] += src[c] * src[3];
+                        }
+
+                        alpha += src[3];
+                    }
+
+                    std::uint8_t* dst = texture.Pixels.data() + next + ((std::size_t)y * nextW + x) * 4;
+
+                    for (int c = 0; c < 3; ++c)
+                    {
+                        dst[c] = alpha == 0 ? 0 : (colour[c] + alpha / 2) / alpha;
+                    }
+
+                    dst[3] = (alpha + 2) / 4;
+                }
+            }
+
+            level = next;
+            w = nextW;
+            h = nextH;
+            ++texture.MipLevels;
+        }
+    }
+
+    void ContentWriter::Premultiply(TextureContent& texture)
+    {
+        for (std::size_t i = 0; i + 3 < texture.Pixels.size(); i += 4)
+        {
+            std::uint32_t alpha = texture.Pixels[i + 3];
+
+            for (std::size_t c = 0; c < 3; ++c)
+            {
+                texture.Pixels[i + c] = (texture.Pixels[i + c] * alpha + 127) / 255;
+            }
+        }
+
+        texture.Premultiplied = true;
+    }
+
+    void ContentWriter::PrepareChunks(TextureContent& texture)
+    {
+        std::size_t rowSize = (std::size_t)texture.Width * 4;
+        std::size_t bandSize = rowSize * texture.BandHeight;
+        texture.Bands.clear();
+
+        for (std::size_t offset = 0; offset < texture.Pixels.size(); offset += bandSize)
+        {
+            texture.Bands.push_back({ texture.Pixels.data() + offset, std::min(bandSize, texture.Pixels.size() - offset), {} });
+        }
+    }
+
+    void ContentWriter::PrepareChunks(FontContent& font)
+    {
+        font.GlyphChunks.clear();
+
+        for (const GlyphContent& glyph : font.Glyphs)
+        {
+            if (glyph.Width != 0 && glyph.Height != 0)
+            {
+                font.GlyphChunks.push_back({ glyph.Coverage.data(), glyph.Coverage.size(), {} });
+            }
+        }
+    }
+
+    void ContentWriter::CompressChunk(ContentChunk& chunk, std::uint8_t level)
+    {
+        if (level == 0)
+        {
+            chunk.Compressed.assign(chunk.Data, chunk.Data + chunk.Size);
+            return;
+        }
+
+        uLongf compressedSize = compressBound(chunk.Size);
+        chunk.Compressed.resize(compressedSize);
+
+        if (compress2(chunk.Compressed.data(), &compressedSize, chunk.Data, chunk.Size, level) != Z_OK)
+        {
+            throw std::runtime_error("Couldn't compress content data.");
+        }
+
+        chunk.Compressed.resize(compressedSize);
+    }
+
+    std::vector<std::uint8_t> ContentWriter::WriteTexture2D(const TextureContent& texture)
+    {
+        std::vector<std::uint8_t> out;
+        WriteHeader(out, ContentFileVersion2, TypeTexture2D);
+        WriteInt32(out, texture.Width);
+        WriteInt32(out, texture.Height);
+        out.push_back(texture.CompressLevel);
+        out.push_back((texture.MipLevels > 1 ? TextureFlagMipmaps : 0) | (texture.Premultiplied ? TextureFlagPremultiplied : 0));
+        WriteInt32(out, texture.BandHeight);
+
+        if (texture.MipLevels > 1)
+        {
+            out.push_back(texture.MipLevels);
+        }
+
+        if (texture.CompressLevel == 0)
+        {
+            out.insert(out.end(), texture.Pixels.begin(), texture.Pixels.end());
+            return out;
+        }
+
+        std::uint32_t offset = 0;
+
+        for (const ContentChunk& band : texture.Bands)
+        {
+            WriteInt32(out, offset);
+            offset += band.Compressed.size();
+        }
+
+        WriteInt32(out, offset);
+
+        for (const ContentChunk& band : texture.Bands)
+        {
+            out.insert(out.end(), band.Compressed.begin(), band.Compressed.end());
+        }
+
+        return out;
+    }
+
+    std::vector<std::uint8_t> ContentWriter::WriteTextureFont(const FontContent& font)
+    {
+        std::vector<std::uint8_t> out;
+        WriteHeader(out, ContentFileVersion1, TypeTextureFont);
+        WriteInt32(out, font.Size);
+        WriteInt32(out, font.Ascender);
+        WriteInt32(out, font.Descender);
+        WriteInt32(out, font.LineSpacing);
+        WriteInt32(out, font.Glyphs.size());
+        std::size_t chunk = 0;
+
+        for (const GlyphContent& glyph : font.Glyphs)
+        {
+            WriteInt32(out, glyph.CharCode);
+            WriteInt32(out, glyph.BearingX);
+            WriteInt32(out, glyph.BearingY);
+            WriteInt32(out, glyph.Advance);
+            WriteInt32(out, glyph.Width);
+            WriteInt32(out, glyph.Height);
+
+            if (glyph.Width == 0 || glyph.Height == 0)
+            {
+                continue;
+            }
+
+            const std::vector<std::uint8_t>& data = font.GlyphChunks[chunk++].Compressed;
+            out.push_back(font.CompressLevel);
+
+            if (font.CompressLevel != 0)
+            {
+                WriteInt32(out, data.size());
+            }
+
+            out.insert(out.end(), data.begin(), data.end());
+        }
+
+        return out;
+    }
+
+    std::vector<std::uint8_t> ContentWriter::WritePack(const std::vector<std::string>& names, const std::vector<std::vector<std::uint8_t>>& entries)
+    {
+        std::vector<std::uint8_t> out;
+        WriteHeader(out, ContentFileVersion1, TypePack);
+        WriteInt32(out, names.size());
+        std::size_t offset = out.size();
+
+        for (const std::string& name : names)
+        {
+            offset += 12 + name.size();
+        }
+
+        for (std::size_t i = 0; i < names.size(); ++i)
+        {
+            WriteInt32(out, names[i].size());
+            out.insert(out.end(), names[i].begin(), names[i].end());
+            WriteInt32(out, offset);
+            WriteInt32(out, entries[i].size());
+            offset += entries[i].size();
+        }
+
+        for (const std::vector<std::uint8_t>& entry : entries)
+        {
+            out.insert(out.end(), entry.begin(), entry.end());
+        }
+
+        return out;
+    }
+}
\ No newline at end of file
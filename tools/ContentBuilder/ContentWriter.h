@@ -0,0 +1,120 @@
+#ifndef FACEENGINE_TOOLS_CONTENTWRITER_H_
+#define FACEENGINE_TOOLS_CONTENTWRITER_H_
+
+#include <cstdint>
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace FaceEngine
+{
+    /**
+     * @brief A compressed (or stored) chunk of content data.
+     *
+     * Chunks are independent of each other so the builder can compress all chunks of all assets in parallel.
+     */
+    struct ContentChunk
+    {
+        const std::uint8_t* Data;
+        std::size_t Size;
+        std::vector<std::uint8_t> Compressed;
+    };
+
+    /**
+     * @brief RGBA image data stored bottom row first, the row order ContentLoader uploads to OpenGL.
+     *
+     * When MipLevels is more than one, Pixels holds the mip levels back to back after the base level.
+     */
+    struct TextureContent
+    {
+        std::uint32_t Width;
+        std::uint32_t Height;
+        std::vector<std::uint8_t> Pixels;
+        std::uint32_t MipLevels = 1;
+        bool Premultiplied = false;
+
+        std::uint8_t CompressLevel = 9;
+        std::uint32_t BandHeight = 64;
+        std::vector<ContentChunk> Bands;
+    };
+
+    /**
+     * @brief A single glyph of a font, with 8-bit coverage data stored bottom row first.
+     */
+    struct GlyphContent
+    {
+        std::uint32_t CharCode;
+        std::int32_t BearingX;
+        std::int32_t BearingY;
+        std::int32_t Advance;
+        std::uint32_t Width;
+        std::uint32_t Height;
+        std::vector<std::uint8_t> Coverage;
+    };
+
+    /**
+     * @brief A rasterised font. Ascender, descender and line spacing are in 26.6 fixed point, matching TextureFont.
+     */
+    struct FontContent
+    {
+        std::uint32_t Size;
+        std::int32_t Ascender;
+        std::int32_t Descender;
+        std::int32_t LineSpacing;
+        std::vector<GlyphContent> Glyphs;
+
+        std::uint8_t CompressLevel = 9;
+        std::vector<ContentChunk> GlyphChunks;
+    };
+
+    /**
+     * @brief Serialises content into the Face Engine content file formats read by ContentLoader.
+     */
+    class ContentWriter
+    {
+    public:
+        /**
+         * @brief Appends a full mip chain to a texture, each level downsampled from the previous one with an alpha-weighted box filter.
+         */
+        static void GenerateMipmaps(TextureContent&);
+
+        /**
+         * @brief Multiplies the colour channels of every texel (including mip levels) by its alpha.
+         */
+        static void Premultiply(TextureContent&);
+
+        /**
+         * @brief Splits a texture into row bands, filling TextureContent::Bands with uncompressed chunks.
+         */
+        static void PrepareChunks(TextureContent&);
+
+        /**
+         * @brief Creates one uncompressed chunk per non-empty glyph, filling FontContent::GlyphChunks.
+         */
+        static void PrepareChunks(FontContent&);
+
+        /**
+         * @brief Deflates a chunk at the given compression level. A level of zero leaves the chunk uncompressed.
+         */
+        static void CompressChunk(ContentChunk&, std::uint8_t);
+
+        /**
+         * @brief Writes a version 2 (banded) Texture2D content file. Chunks must have been compressed.
+         */
+        static std::vector<std::uint8_t> WriteTexture2D(const TextureContent&);
+
+        /**
+         * @brief Writes a version 1 TextureFont content file. Chunks must have been compressed.
+         */
+        static std::vector<std::uint8_t> WriteTextureFont(const FontContent&);
+
+        /**
+         * @brief Writes a pack file containing the given named content files.
+         */
+        static std::vector<std::uint8_t> WritePack(const std::vector<std::string>&, const std::vector<std::vector<std::uint8_t>>&);
+
+        static void WriteInt32(std::vector<std::uint8_t>&, std::uint32_t);
+    };
+}
+
+#endif
\ No newline at end of file
@@ -0,0 +1,69 @@
+#include "FontRasteriser.h"
+
+#include <stdexcept>
+#include <ft2build.h>
+#include FT_FREETYPE_H
+
+namespace FaceEngine
+{
+    FontContent FontRasteriser::Rasterise(const std::vector<std::uint8_t>& data, std::uint32_t size, std::uint32_t first, std::uint32_t last)
+    {
+        FT_Library library;
+        FT_Face face;
+
+        if (FT_Init_FreeType(&library))
+        {
+            throw std::runtime_error("Couldn't initialise FreeType.");
+        }
+
+        if (FT_New_Memory_Face(library, data.data(), data.size(), 0, &face))
+        {
+            FT_Done_FreeType(library);
+            throw std::runtime_error("Couldn't read font.");
+        }
+
+        if (FT_Set_Pixel_Sizes(face, 0, size))
+        {
+            FT_Done_Face(face);
+            FT_Done_FreeType(library);
+            throw std::runtime_error("Font can't be rasterised at the requested size.");
+        }
+
+        FontContent font;
+        font.Size = size;
+        font.Ascender = face->size->metrics.ascender;
+        font.Descender = face->size->metrics.descender;
+        font.LineSpacing = face->size->metrics.height;
+
+        for (std::uint32_t charCode = first; charCode <= last; ++charCode)
+        {
+            if (FT_Load_Char(face, charCode, FT_LOAD_RENDER))
+            {
+                continue;
+            }
+
+            FT_GlyphSlot slot = face->glyph;
+            GlyphContent glyph;
+            glyph.CharCode = charCode;
+            glyph.BearingX = slot->bitmap_left;
+            glyph.BearingY = slot->bitmap_top;
+            glyph.Advance = slot->advance.x >> 6;
+            glyph.Width = slot->bitmap.width;
+            glyph.Height = slot->bitmap.rows;
+            glyph.Coverage.resize((std::size_t)glyph.Width * glyph.Height);
+
+            for (std::uint32_t y = 0; y < glyph.Height; ++y)
+            {
+                // FreeType bitmaps are top row first
+                const std::uint8_t* row = slot->bitmap.buffer + (std::ptrdiff_t)(glyph.Height - 1 - y) * slot->bitmap.pitch;
+                std::copy(row, row + glyph.Width, glyph.Coverage.begin() + (std::size_t)y * glyph.Width);
+            }
+
+            font.Glyphs.push_back(std::move(glyph));
+        }
+
+        FT_Done_Face(face);
+        FT_Done_FreeType(library);
+        return font;
+    }
+}
\ No newline at end of file
@@ -0,0 +1,24 @@
+#ifndef FACEENGINE_TOOLS_FONTRASTERISER_H_
+#define FACEENGINE_TOOLS_FONTRASTERISER_H_
+
+#include <cstdint>
+#include <vector>
+
+#include "ContentWriter.h"
+
+namespace FaceEngine
+{
+    /**
+     * @brief Rasterises TrueType/OpenType fonts into glyph bitmaps with FreeType.
+     */
+    class FontRasteriser
+    {
+    public:
+        /**
+         * @brief Rasterises the inclusive character range [first, last] of a font file held in memory at the given pixel size.
+         */
+        static FontContent Rasterise(const std::vector<std::uint8_t>&, std::uint32_t, std::uint32_t, std::uint32_t);
+    };
+}
+
+#endif
\ No newline at end of file
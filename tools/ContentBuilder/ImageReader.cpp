@@ -0,0 +1,155 @@
+#include "ImageReader.h"
+
+#include <algorithm>
+#include <cctype>
+#include <stdexcept>
+#include <png.h>
+
+namespace FaceEngine
+{
+    TextureContent ImageReader::ReadImage(const std::string& path, const std::vector<std::uint8_t>& data)
+    {
+        std::string extension = path.substr(path.find_last_of('.') + 1);
+        std::transform(extension.begin(), extension.end(), extension.begin(), [](unsigned char c) { return std::tolower(c); });
+
+        if (extension == "png")
+        {
+            return ReadPNG(data);
+        }
+        else if (extension == "tga")
+        {
+            return ReadTGA(data);
+        }
+
+        throw std::runtime_error("Unsupported image format \"" + extension + "\".");
+    }
+
+    TextureContent ImageReader::ReadPNG(const std::vector<std::uint8_t>& data)
+    {
+        png_image image = {};
+        image.version = PNG_IMAGE_VERSION;
+
+        if (!png_image_begin_read_from_memory(&image, data.data(), data.size()))
+        {
+            throw std::runtime_error(std::string("Couldn't read PNG: ") + image.message);
+        }
+
+        image.format = PNG_FORMAT_RGBA;
+        TextureContent texture;
+        texture.Width = image.width;
+        texture.Height = image.height;
+        texture.Pixels.resize(PNG_IMAGE_SIZE(image));
+
+        // a negative row stride makes libpng write the bottom row first
+        if (!png_image_finish_read(&image, nullptr, texture.Pixels.data(), -(png_int_32)PNG_IMAGE_ROW_STRIDE(image), nullptr))
+        {
+            png_image_free(&image);
+            throw std::runtime_error(std::string("Couldn't decode PNG: ") + image.message);
+        }
+
+        return texture;
+    }
+
+    TextureContent ImageReader::ReadTGA(const std::vector<std::uint8_t>& data)
+    {
+        if (data.size() < 18)
+        {
+            throw std::runtime_error("Invalid TGA file.");
+        }
+
+        std::uint8_t idLength = data[0];
+        std::uint8_t colourMapType = data[1];
+        std::uint8_t imageType = data[2];
+        std::uint32_t colourMapLength = data[5] | (data[6] << 8);
+        std::uint8_t colourMapDepth = data[7];
+        std::uint32_t width = data[12] | (data[13] << 8);
+        std::uint32_t height = data[14] | (data[15] << 8);
+        std::uint8_t depth = data[16];
+        bool topOrigin = data[17] & 0x20;
+        bool rle = imageType == 10 || imageType == 11;
+        bool greyscale = imageType == 3 || imageType == 11;
+
+        if ((imageType != 2 && imageType != 3 && imageType != 10 && imageType != 11) ||
+            (greyscale && depth != 8) || (!greyscale && depth != 24 && depth != 32))
+        {
+            throw std::runtime_error("Unsupported TGA file, only true colour and greyscale images are supported.");
+        }
+
+        std::size_t pos = 18 + idLength + (colourMapType == 1 ? colourMapLength * ((colourMapDepth + 7) / 8) : 0);
+        std::size_t bytesPerPixel = depth / 8;
+        std::size_t pixelCount = (std::size_t)width * height;
+        std::vector<std::uint8_t> raw(pixelCount * bytesPerPixel);
+
+        if (rle)
+        {
+            std::size_t written = 0;
+
+            while (written < raw.size())
+            {
+                if (pos >= data.size())
+                {
+                    throw std::runtime_error("Invalid TGA file.");
+                }
+
+                std::uint8_t packet = data[pos++];
+                std::size_t count = (packet & 0x7F) + 1;
+                std::size_t packetSize = packet & 0x80 ? bytesPerPixel : count * bytesPerPixel;
+
+                if (pos + packetSize > data.size() || written + count * bytesPerPixel > raw.size())
+                {
+                    throw std::runtime_error("Invalid TGA file.");
+                }
+
+                for (std::size_t i = 0; i < count; ++i)
+                {
+                    std::size_t source = packet & 0x80 ? pos : pos + i * bytesPerPixel;
+                    std::copy(data.begin() + source, data.begin() + source + bytesPerPixel, raw.begin() + written);
+                    written += bytesPerPixel;
+                }
+
+                pos += packetSize;
+            }
+        }
+        else
+        {
+            if (pos + raw.size() > data.size())
+            {
+                throw std::runtime_error("Invalid TGA file.");
+            }
+
+            std::copy(data.begin() + pos, data.begin() + pos + raw.size(), raw.begin());
+        }
+
+        TextureContent texture;
+        texture.Width = width;
+        texture.Height = height;
+        texture.Pixels.resize(pixelCount * 4);
+
+        for (std::uint32_t y = 0; y < height; ++y)
+        {
+            // TGA images are stored bottom row first unless the origin bit is set
+            std::uint32_t sourceRow = topOrigin ? height - 1 - y : y;
+
+            for (std::uint32_t x = 0; x < width; ++x)
+            {
+                const std::uint8_t* source = &raw[((std::size_t)sourceRow * width + x) * bytesPerPixel];
+                std::uint8_t* target = &texture.Pixels[((std::size_t)y * width + x) * 4];
+
+                if (greyscale)
+                {
+                    target[0] = target[1] = target[2] = source[0];
+                    target[3] = 0xFF;
+                }
+                else
+                {
+                    target[0] = source[2];
+                    target[1] = source[1];
+                    target[2] = source[0];
+                    target[3] = bytesPerPixel == 4 ? source[3] : 0xFF;
+                }
+            }
+        }
+
+        return texture;
+    }
+}
\ No newline at end of file
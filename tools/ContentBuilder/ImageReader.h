@@ -0,0 +1,28 @@
+#ifndef FACEENGINE_TOOLS_IMAGEREADER_H_
+#define FACEENGINE_TOOLS_IMAGEREADER_H_
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "ContentWriter.h"
+
+namespace FaceEngine
+{
+    /**
+     * @brief Decodes source images into RGBA TextureContent (bottom row first).
+     */
+    class ImageReader
+    {
+    public:
+        /**
+         * @brief Decodes a PNG or TGA image from memory, choosing the decoder from the extension of the path.
+         */
+        static TextureContent ReadImage(const std::string&, const std::vector<std::uint8_t>&);
+
+        static TextureContent ReadPNG(const std::vector<std::uint8_t>&);
+        static TextureContent ReadTGA(const std::vector<std::uint8_t>&);
+    };
+}
+
+#endif
\ No newline at end of file
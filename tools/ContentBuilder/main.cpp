@@ -0,0 +1,551 @@
+/**
+ * @file main.cpp
+ * @brief FaceEngineContentBuilder, converts source assets into Face Engine content files.
+ *
+ * Usage: FaceEngineContentBuilder <manifest> [-o <output directory>] [-j <threads>] [--force]
+ *
+ * Each non-empty manifest line that doesn't start with '#' describes one output:
+ *
+ *     texture <image.png|image.tga> <output> [level=<0-9>] [band=<rows>] [mips=<0|1>] [premultiply=<0|1>]
+ *     font    <font.ttf>            <output> size=<pixels> [level=<0-9>] [chars=<first>-<last>]
+ *     pack    <output> <entry> [<entry> ...]
+ *
+ * Inputs are relative to the manifest, outputs and pack entries are relative to the output directory (the manifest's directory by default).
+ * Outputs whose inputs and options hash to the same value as the previous build are skipped unless --force is given.
+ */
+
+#include <atomic>
+#include <chrono>
+#include <exception>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <mutex>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "BuildCache.h"
+#include "ContentWriter.h"
+#include "FontRasteriser.h"
+#include "ImageReader.h"
+
+namespace fs = std::filesystem;
+using namespace FaceEngine;
+
+namespace
+{
+    // bump whenever the output of the builder changes so every output is rebuilt
+    constexpr const char* BuilderFormat = "FaceEngineContentBuilder 1";
+
+    enum class ItemKind
+    {
+        Texture,
+        Font,
+        Pack
+    };
+
+    struct BuildItem
+    {
+        ItemKind Kind;
+        int Line;
+        std::string Input;
+        std::string Name;
+        std::string Output;
+        std::uint8_t CompressLevel = 9;
+        std::uint32_t BandHeight = 64;
+        bool Mipmaps = false;
+        bool Premultiply = false;
+        std::uint32_t FontSize = 0;
+        std::uint32_t FirstChar = 32;
+        std::uint32_t LastChar = 126;
+        std::vector<std::string> Entries;
+
+        std::uint64_t Hash = 0;
+        bool Stale = false;
+        std::string Error;
+        std::vector<std::uint8_t> Source;
+        TextureContent Texture;
+        FontContent Font;
+    };
+
+    std::vector<std::uint8_t> ReadFile(const std::string& path)
+    {
+        std::ifstream file(path, std::ios::binary);
+
+        if (!file)
+        {
+            throw std::runtime_error("Couldn't open \"" + path + "\" for reading.");
+        }
+
+        return std::vector<std::uint8_t>(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+    }
+
+    void WriteFile(const std::string& path, const std::vector<std::uint8_t>& data)
+    {
+        fs::path parent = fs::path(path).parent_path();
+
+        if (!parent.empty())
+        {
+            fs::create_directories(parent);
+        }
+
+        std::ofstream file(path, std::ios::binary | std::ios::trunc);
+
+        if (!file.write((const char*)data.data(), data.size()))
+        {
+            throw std::runtime_error("Couldn't write \"" + path + "\".");
+        }
+    }
+
+    /**
+     * @brief Runs the function for every index in [0, count) across the given number of threads.
+     *
+     * If the function throws, no further indices are started and the first exception is rethrown once every thread has finished.
+     */
+    template <typename F>
+    void ParallelFor(std::size_t count, unsigned int threadCount, F function)
+    {
+        std::atomic_size_t next(0);
+        std::exception_ptr error;
+        std::mutex errorMutex;
+        auto worker = [&]()
+        {
+            try
+            {
+                for (std::size_t i = next.fetch_add(1); i < count; i = next.fetch_add(1))
+                {
+                    function(i);
+                }
+            }
+            catch (...)
+            {
+                std::lock_guard<std::mutex> lock(errorMutex);
+
+                if (!error)
+                {
+                    error = std::current_exception();
+                }
+
+                next = count;
+            }
+        };
+
+        std::vector<std::thread> threads;
+
+        for (unsigned int i = 1; i < std::min<std::size_t>(threadCount, count); ++i)
+        {
+            threads.emplace_back(worker);
+        }
+
+        worker();
+
+        for (std::thread& thread : threads)
+        {
+            thread.join();
+        }
+
+        if (error)
+        {
+            std::rethrow_exception(error);
+        }
+    }
+
+    std::uint32_t ParseNumber(const std::string& value, const std::string& option)
+    {
+        try
+        {
+            std::size_t used;
+            unsigned long number = std::stoul(value, &used, 0);
+
+            if (used == value.size() && number <= 0xFFFFFFFFUL)
+            {
+                return number;
+            }
+        }
+        catch (const std::exception&) { }
+
+        throw std::runtime_error("Invalid value \"" + value + "\" for " + option + ".");
+    }
+
+    BuildItem ParseLine(const std::string& line, int lineNumber, const fs::path& inputDir, const fs::path& outputDir)
+    {
+        std::istringstream stream(line);
+        std::vector<std::string> words;
+
+        for (std::string word; stream >> word;)
+        {
+            words.push_back(word);
+        }
+
+        BuildItem item;
+        item.Line = lineNumber;
+
+        if (words[0] == "pack")
+        {
+            if (words.size() < 3)
+            {
+                throw std::runtime_error("A pack needs an output and at least one entry.");
+            }
+
+            item.Kind = ItemKind::Pack;
+            item.Name = words[1];
+            item.Output = (outputDir / words[1]).string();
+            item.Entries.assign(words.begin() + 2, words.end());
+            return item;
+        }
+        else if (words[0] == "texture")
+        {
+            item.Kind = ItemKind::Texture;
+        }
+        else if (words[0] == "font")
+        {
+            item.Kind = ItemKind::Font;
+        }
+        else
+        {
+            throw std::runtime_error("Unknown content type \"" + words[0] + "\".");
+        }
+
+        if (words.size() < 3)
+        {
+            throw std::runtime_error("Expected an input and an output.");
+        }
+
+        item.Input = (inputDir / words[1]).string();
+        item.Name = words[2];
+        item.Output = (outputDir / words[2]).string();
+
+        for (std::size_t i = 3; i < words.size(); ++i)
+        {
+            std::size_t equals = words[i].find('=');
+            std::string option = words[i].substr(0, equals);
+            std::string value = equals == std::string::npos ? "" : words[i].substr(equals + 1);
+
+            if (option == "level")
+            {
+                item.CompressLevel = std::min(ParseNumber(value, option), 9U);
+            }
+            else if (option == "band" && item.Kind == ItemKind::Texture)
+            {
+                item.BandHeight = std::max(ParseNumber(value, option), 1U);
+            }
+            else if (option == "mips" && item.Kind == ItemKind::Texture)
+            {
+                item.Mipmaps = ParseNumber(value, option) != 0;
+            }
+            else if (option == "premultiply" && item.Kind == ItemKind::Texture)
+            {
+                item.Premultiply = ParseNumber(value, option) != 0;
+            }
+            else if (option == "size" && item.Kind == ItemKind::Font)
+            {
+                item.FontSize = ParseNumber(value, option);
+            }
+            else if (option == "chars" && item.Kind == ItemKind::Font && value.find('-') != std::string::npos)
+            {
+                item.FirstChar = ParseNumber(value.substr(0, value.find('-')), option);
+                item.LastChar = ParseNumber(value.substr(value.find('-') + 1), option);
+            }
+            else
+            {
+                throw std::runtime_error("Unknown option \"" + words[i] + "\".");
+            }
+        }
+
+        if (item.Kind == ItemKind::Font && item.FontSize == 0)
+        {
+            throw std::runtime_error("Fonts need a size.");
+        }
+
+        return item;
+    }
+
+    std::string DescribeOptions(const BuildItem& item)
+    {
+        std::ostringstream options;
+        options << BuilderFormat << ' ' << (int)item.Kind << ' ' << (int)item.CompressLevel << ' ' << item.BandHeight << ' '
+                << item.Mipmaps << ' ' << item.Premultiply << ' ' << item.FontSize << ' ' << item.FirstChar << ' ' << item.LastChar;
+        return options.str();
+    }
+
+    void Decode(BuildItem& item)
+    {
+        if (item.Kind == ItemKind::Texture)
+        {
+            item.Texture = ImageReader::ReadImage(item.Input, item.Source);
+
+            if (item.Texture.Width < 1 || item.Texture.Width > 2048 || item.Texture.Height < 1 || item.Texture.Height > 2048)
+            {
+                throw std::runtime_error("Textures must be between 1x1 and 2048x2048.");
+            }
+
+            if (item.Mipmaps)
+            {
+                ContentWriter::GenerateMipmaps(item.Texture);
+            }
+
+            // mip levels are filtered before premultiplying, the alpha-weighted filter gives the same result either way
+            if (item.Premultiply)
+            {
+                ContentWriter::Premultiply(item.Texture);
+            }
+
+            item.Texture.CompressLevel = item.CompressLevel;
+            item.Texture.BandHeight = item.BandHeight;
+            ContentWriter::PrepareChunks(item.Texture);
+        }
+        else
+        {
+            item.Font = FontRasteriser::Rasterise(item.Source, item.FontSize, item.FirstChar, item.LastChar);
+            item.Font.CompressLevel = item.CompressLevel;
+            ContentWriter::PrepareChunks(item.Font);
+        }
+
+        item.Source.clear();
+        item.Source.shrink_to_fit();
+    }
+}
+
+int main(int argc, char** argv)
+{
+    std::string manifestPath;
+    std::string outputDirArg;
+    unsigned int threadCount = std::max(std::thread::hardware_concurrency(), 1U);
+    bool force = false;
+
+    for (int i = 1; i < argc; ++i)
+    {
+        std::string arg = argv[i];
+
+        if (arg == "-o" && i + 1 < argc)
+        {
+            outputDirArg = argv[++i];
+        }
+        else if (arg == "-j" && i + 1 < argc)
+        {
+            threadCount = std::max(std::atoi(argv[++i]), 1);
+        }
+        else if (arg == "--force")
+        {
+            force = true;
+        }
+        else if (manifestPath.empty() && arg[0] != '-')
+        {
+            manifestPath = arg;
+        }
+        else
+        {
+            manifestPath.clear();
+            break;
+        }
+    }
+
+    if (manifestPath.empty())
+    {
+        std::cerr << "Usage: FaceEngineContentBuilder <manifest> [-o <output directory>] [-j <threads>] [--force]\n";
+        return 2;
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    fs::path inputDir = fs::path(manifestPath).parent_path();
+    fs::path outputDir = outputDirArg.empty() ? inputDir : fs::path(outputDirArg);
+    std::ifstream manifest(manifestPath);
+
+    if (!manifest)
+    {
+        std::cerr << "Couldn't open manifest \"" << manifestPath << "\".\n";
+        return 1;
+    }
+
+    std::vector<BuildItem> items;
+    int lineNumber = 0;
+    bool failed = false;
+
+    for (std::string line; std::getline(manifest, line);)
+    {
+        ++lineNumber;
+        std::size_t first = line.find_first_not_of(" \t\r");
+
+        if (first == std::string::npos || line[first] == '#')
+        {
+            continue;
+        }
+
+        try
+        {
+            items.push_back(ParseLine(line, lineNumber, inputDir, outputDir));
+        }
+        catch (const std::exception& e)
+        {
+            std::cerr << manifestPath << ":" << lineNumber << ": " << e.what() << "\n";
+            failed = true;
+        }
+    }
+
+    if (failed)
+    {
+        return 1;
+    }
+
+    BuildCache cache((outputDir / ".fecache").string());
+
+    // hash and decode every stale asset, reading files and decoding images in parallel
+    ParallelFor(items.size(), threadCount, [&](std::size_t i)
+    {
+        BuildItem& item = items[i];
+
+        if (item.Kind == ItemKind::Pack)
+        {
+            return;
+        }
+
+        try
+        {
+            item.Source = ReadFile(item.Input);
+            item.Hash = BuildCache::Hash(item.Source.data(), item.Source.size(), BuildCache::Hash(DescribeOptions(item)));
+            item.Stale = force || !cache.IsUpToDate(item.Output, item.Hash);
+
+            if (item.Stale)
+            {
+                Decode(item);
+            }
+        }
+        catch (const std::exception& e)
+        {
+            item.Error = e.what();
+        }
+    });
+
+    // compress the bands and glyphs of every asset together so a single large texture still uses every core
+    std::vector<std::pair<ContentChunk*, BuildItem*>> chunks;
+
+    for (BuildItem& item : items)
+    {
+        if (!item.Stale || !item.Error.empty())
+        {
+            continue;
+        }
+
+        std::vector<ContentChunk>& itemChunks = item.Kind == ItemKind::Texture ? item.Texture.Bands : item.Font.GlyphChunks;
+
+        for (ContentChunk& chunk : itemChunks)
+        {
+            chunks.emplace_back(&chunk, &item);
+        }
+    }
+
+    // several chunks of an item may fail at once, so errors are collected per chunk and given to their items afterwards
+    std::vector<std::string> chunkErrors(chunks.size());
+
+    ParallelFor(chunks.size(), threadCount, [&](std::size_t i)
+    {
+        try
+        {
+            ContentWriter::CompressChunk(*chunks[i].first, chunks[i].second->CompressLevel);
+        }
+        catch (const std::exception& e)
+        {
+            chunkErrors[i] = e.what();
+        }
+    });
+
+    for (std::size_t i = 0; i < chunks.size(); ++i)
+    {
+        if (!chunkErrors[i].empty() && chunks[i].second->Error.empty())
+        {
+            chunks[i].second->Error = chunkErrors[i];
+        }
+    }
+
+    ParallelFor(items.size(), threadCount, [&](std::size_t i)
+    {
+        BuildItem& item = items[i];
+
+        if (item.Kind == ItemKind::Pack || !item.Stale || !item.Error.empty())
+        {
+            return;
+        }
+
+        try
+        {
+            WriteFile(item.Output, item.Kind == ItemKind::Texture ? ContentWriter::WriteTexture2D(item.Texture) : ContentWriter::WriteTextureFont(item.Font));
+            item.Texture = TextureContent();
+            item.Font = FontContent();
+        }
+        catch (const std::exception& e)
+        {
+            item.Error = e.what();
+        }
+    });
+
+    // packs are built last as their entries may be outputs of this build
+    for (BuildItem& item : items)
+    {
+        if (item.Kind != ItemKind::Pack)
+        {
+            continue;
+        }
+
+        try
+        {
+            std::vector<std::vector<std::uint8_t>> entries;
+            item.Hash = BuildCache::Hash(DescribeOptions(item));
+
+            for (const std::string& entry : item.Entries)
+            {
+                entries.push_back(ReadFile((outputDir / entry).string()));
+                item.Hash = BuildCache::Hash(entry, item.Hash);
+                item.Hash = BuildCache::Hash(entries.back().data(), entries.back().size(), item.Hash);
+            }
+
+            item.Stale = force || !cache.IsUpToDate(item.Output, item.Hash);
+
+            if (item.Stale)
+            {
+                WriteFile(item.Output, ContentWriter::WritePack(item.Entries, entries));
+            }
+        }
+        catch (const std::exception& e)
+        {
+            item.Error = e.what();
+        }
+    }
+
+    std::size_t built = 0, upToDate = 0, errors = 0;
+
+    for (const BuildItem& item : items)
+    {
+        if (!item.Error.empty())
+        {
+            std::cerr << manifestPath << ":" << item.Line << ": " << item.Name << ": " << item.Error << "\n";
+            ++errors;
+        }
+        else if (item.Stale)
+        {
+            cache.Update(item.Output, item.Hash);
+            std::cout << "Built " << item.Name << "\n";
+            ++built;
+        }
+        else
+        {
+            ++upToDate;
+        }
+    }
+
+    try
+    {
+        cache.Save();
+    }
+    catch (const std::exception& e)
+    {
+        std::cerr << e.what() << "\n";
+        ++errors;
+    }
+
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    std::cout << built << " built, " << upToDate << " up to date, " << errors << " failed in " << seconds << "s\n";
+    return errors == 0 ? 0 : 1;
+}
\ No newline at end of file